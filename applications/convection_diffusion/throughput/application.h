@@ -67,6 +67,7 @@ public:
     // clang-format off
     prm.enter_subsection("Application");
       prm.add_parameter("MeshType",  mesh_type_string, "Type of mesh (Cartesian versus curvilinear).", dealii::Patterns::Selection("Cartesian|Curvilinear"));
+      prm.add_parameter("AnisotropyFactor", anisotropy_factor, "Number of subdivisions in y-direction relative to the other directions.", dealii::Patterns::Integer(1));
     prm.leave_subsection();
     // clang-format on
   }
@@ -143,10 +144,14 @@ private:
       AssertThrow(false, dealii::ExcMessage("Not implemented."));
     }
 
+    // anisotropic cells that are refined in y-direction
+    std::vector<unsigned int> n_subdivisions(dim, this->n_subdivisions_1d_hypercube);
+    n_subdivisions[1] *= anisotropy_factor;
+
     create_periodic_box(this->grid->triangulation,
                         this->param.grid.n_refine_global,
                         this->grid->periodic_face_pairs,
-                        this->n_subdivisions_1d_hypercube,
+                        n_subdivisions,
                         left,
                         right,
                         curvilinear_mesh,
@@ -180,6 +185,8 @@ private:
 
   std::string mesh_type_string = "Cartesian";
   MeshType    mesh_type        = MeshType::Cartesian;
+
+  unsigned int anisotropy_factor = 1;
 };
 
 } // namespace ConvDiff
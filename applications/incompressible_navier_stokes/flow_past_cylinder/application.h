@@ -427,6 +427,7 @@ private:
     pp_data.pressure_difference_data.time_control_data.is_active                = true;
     pp_data.pressure_difference_data.time_control_data.trigger_every_time_steps = 1;
     pp_data.pressure_difference_data.time_control_data.start_time               = start_time;
+    pp_data.pressure_difference_data.update_points_before_evaluation            = false;
     if(dim == 2)
     {
       dealii::Point<dim> point_1_2D((X_C - D / 2.0), Y_C), point_2_2D((X_C + D / 2.0), Y_C);
@@ -359,6 +359,7 @@ public:
     pp_data.pressure_difference_data.time_control_data.is_active                = true;
     pp_data.pressure_difference_data.time_control_data.trigger_every_time_steps = 1;
     pp_data.pressure_difference_data.time_control_data.start_time               = start_time;
+    pp_data.pressure_difference_data.update_points_before_evaluation            = false;
     Point<dim> point_1, point_2;
     point_1[0]                               = -radius;
     point_2[0]                               = radius;
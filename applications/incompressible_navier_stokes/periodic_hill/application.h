@@ -111,6 +111,9 @@ public:
       prm.add_parameter("ReynoldsNumber",       Re,                           "Reynolds number (ignored if Inviscid = true)");
       prm.add_parameter("EndTime",              end_time_multiples,           "End time in multiples of flow through time.", dealii::Patterns::Integer(0.0,1000.0));
       prm.add_parameter("GridStretchFactor",    grid_stretch_factor,          "Factor describing grid stretching in vertical direction.");
+      prm.add_parameter("SubdivisionsX1",       n_subdivisions[0],            "Number of coarse cells in streamwise direction.", dealii::Patterns::Integer(1,1000));
+      prm.add_parameter("SubdivisionsX2",       n_subdivisions[1],            "Number of coarse cells in vertical direction.", dealii::Patterns::Integer(1,1000));
+      prm.add_parameter("SubdivisionsX3",       n_subdivisions[2],            "Number of coarse cells in spanwise direction.", dealii::Patterns::Integer(1,1000));
       prm.add_parameter("CalculateStatistics",  calculate_statistics,         "Decides whether statistics are calculated.");
       prm.add_parameter("SampleStartTime",      sample_start_time_multiples,  "Start time of sampling in multiples of flow through time.", dealii::Patterns::Integer(0.0,1000.0));
       prm.add_parameter("SampleEveryTimeSteps", sample_every_timesteps,       "Sample every ... time steps.", dealii::Patterns::Integer(1,1000));
@@ -239,36 +242,41 @@ private:
     if(dim == 3)
       p_2[2] = width / 2.0;
 
-    // use 2 cells in x-direction on coarsest grid and 1 cell in y- and z-directions
-    std::vector<unsigned int> refinements(dim, 1);
-    refinements[0] = 2;
+    // use n_subdivisions[i] cells in direction i on the coarsest grid; boundary ids are colored:
+    // 0/1 in x-direction, 2/3 in y-direction, 4/5 in z-direction
+    std::vector<unsigned int> repetitions(n_subdivisions.begin(), n_subdivisions.begin() + dim);
     dealii::GridGenerator::subdivided_hyper_rectangle(*this->grid->triangulation,
-                                                      refinements,
+                                                      repetitions,
                                                       p_1,
-                                                      p_2);
+                                                      p_2,
+                                                      true);
 
-    // create hill by shifting y-coordinates of middle vertices by -H in y-direction
-    this->grid->triangulation->last()->vertex(0)[1] = 0.;
-    if(dim == 3)
-      this->grid->triangulation->last()->vertex(4)[1] = 0.;
-
-    // periodicity in x-direction (add 10 to avoid conflicts with dirichlet boundary, which is 0)
-    // make use of the fact that the mesh has only two elements
+    // create hill by moving the coarse vertices onto the manifold, which shifts the bottom
+    // wall according to the hill geometry and applies the grid stretching in y-direction
+    static const PeriodicHillManifold<dim> manifold =
+      PeriodicHillManifold<dim>(H, length, height, grid_stretch_factor);
 
-    // left element
-    this->grid->triangulation->begin()->face(0)->set_all_boundary_ids(0 + 10);
-    // right element
-    this->grid->triangulation->last()->face(1)->set_all_boundary_ids(1 + 10);
+    dealii::GridTools::transform(
+      [&](dealii::Point<dim> const & p) { return manifold.push_forward(p); },
+      *this->grid->triangulation);
 
-    // periodicity in z-direction
-    if(dim == 3)
+    // walls get boundary id 0, periodic boundaries in x- and z-direction get ids 10-13 (add 10 to
+    // avoid conflicts with the dirichlet boundary)
+    for(auto cell : this->grid->triangulation->cell_iterators())
     {
-      // left element
-      this->grid->triangulation->begin()->face(4)->set_all_boundary_ids(2 + 10);
-      this->grid->triangulation->begin()->face(5)->set_all_boundary_ids(3 + 10);
-      // right element
-      this->grid->triangulation->last()->face(4)->set_all_boundary_ids(4 + 10);
-      this->grid->triangulation->last()->face(5)->set_all_boundary_ids(5 + 10);
+      for(auto const & f : cell->face_indices())
+      {
+        if(cell->at_boundary(f))
+        {
+          dealii::types::boundary_id const color = cell->face(f)->boundary_id();
+          if(color == 2 || color == 3)
+            cell->face(f)->set_all_boundary_ids(0);
+          else if(color < 2)
+            cell->face(f)->set_all_boundary_ids(color + 10);
+          else
+            cell->face(f)->set_all_boundary_ids(color - 2 + 10);
+        }
+      }
     }
 
     dealii::GridTools::collect_periodic_faces(
@@ -277,18 +285,15 @@ private:
     {
       dealii::GridTools::collect_periodic_faces(
         *this->grid->triangulation, 2 + 10, 3 + 10, 2, this->grid->periodic_face_pairs);
-      dealii::GridTools::collect_periodic_faces(
-        *this->grid->triangulation, 4 + 10, 5 + 10, 2, this->grid->periodic_face_pairs);
     }
 
     this->grid->triangulation->add_periodicity(this->grid->periodic_face_pairs);
 
     unsigned int const manifold_id = 111;
-    this->grid->triangulation->begin()->set_all_manifold_ids(manifold_id);
-    this->grid->triangulation->last()->set_all_manifold_ids(manifold_id);
-
-    static const PeriodicHillManifold<dim> manifold =
-      PeriodicHillManifold<dim>(H, length, height, grid_stretch_factor);
+    for(auto cell : this->grid->triangulation->cell_iterators())
+    {
+      cell->set_all_manifold_ids(manifold_id);
+    }
     this->grid->triangulation->set_manifold(manifold_id, manifold);
 
     this->grid->triangulation->refine_global(this->param.grid.n_refine_global);
@@ -516,6 +521,9 @@ private:
   // grid
   double grid_stretch_factor = 1.6;
 
+  // number of coarse cells per direction (only the first dim entries are used)
+  std::array<unsigned int, 3> n_subdivisions = {{2, 1, 1}};
+
   // postprocessing
 
   // sampling
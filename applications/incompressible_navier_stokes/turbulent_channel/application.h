@@ -251,6 +251,20 @@ public:
   {
   }
 
+  void
+  add_parameters(dealii::ParameterHandler & prm) final
+  {
+    ApplicationBase<dim, Number>::add_parameters(prm);
+
+    // clang-format off
+    prm.enter_subsection("Application");
+      prm.add_parameter("SubdivisionsX1", n_subdivisions[0], "Number of coarse cells in streamwise direction.",   dealii::Patterns::Integer(1,1000));
+      prm.add_parameter("SubdivisionsX2", n_subdivisions[1], "Number of coarse cells in wall-normal direction.",  dealii::Patterns::Integer(1,1000));
+      prm.add_parameter("SubdivisionsX3", n_subdivisions[2], "Number of coarse cells in spanwise direction.",     dealii::Patterns::Integer(1,1000));
+    prm.leave_subsection();
+    // clang-format on
+  }
+
 private:
   void
   set_parameters() final
@@ -399,9 +413,23 @@ private:
     if(dim == 3)
       dimensions[2] = DIMENSIONS_X3;
 
-    dealii::GridGenerator::hyper_rectangle(*this->grid->triangulation,
-                                           dealii::Point<dim>(-dimensions / 2.0),
-                                           dealii::Point<dim>(dimensions / 2.0));
+    // boundary ids are colored: 0/1 in x-direction, 2/3 in y-direction, 4/5 in z-direction
+    std::vector<unsigned int> repetitions(n_subdivisions.begin(), n_subdivisions.begin() + dim);
+    dealii::GridGenerator::subdivided_hyper_rectangle(*this->grid->triangulation,
+                                                      repetitions,
+                                                      dealii::Point<dim>(-dimensions / 2.0),
+                                                      dealii::Point<dim>(dimensions / 2.0),
+                                                      true);
+
+    // place the coarse vertices in y-direction onto the stretched grid so that the coarse cells
+    // are equidistant in reference space, as assumed by the manifold and the statistics manager
+    dealii::GridTools::transform(
+      [&](dealii::Point<dim> const & p) {
+        dealii::Point<dim> x = p;
+        x[1]                 = grid_transform_y(p[1] / dimensions[1] + 0.5);
+        return x;
+      },
+      *this->grid->triangulation);
 
     // manifold
     unsigned int manifold_id = 1;
@@ -414,14 +442,23 @@ private:
     static const ManifoldTurbulentChannel<dim> manifold(dimensions);
     this->grid->triangulation->set_manifold(manifold_id, manifold);
 
-    // periodicity in x--direction
-    this->grid->triangulation->begin()->face(0)->set_all_boundary_ids(0 + 10);
-    this->grid->triangulation->begin()->face(1)->set_all_boundary_ids(1 + 10);
-    // periodicity in z-direction
-    if(dim == 3)
+    // walls get boundary id 0, periodic boundaries in x- and z-direction get ids 10-13 (add 10
+    // to avoid conflicts with the dirichlet boundary)
+    for(auto cell : this->grid->triangulation->cell_iterators())
     {
-      this->grid->triangulation->begin()->face(4)->set_all_boundary_ids(2 + 10);
-      this->grid->triangulation->begin()->face(5)->set_all_boundary_ids(3 + 10);
+      for(auto const & f : cell->face_indices())
+      {
+        if(cell->at_boundary(f))
+        {
+          dealii::types::boundary_id const color = cell->face(f)->boundary_id();
+          if(color == 2 || color == 3)
+            cell->face(f)->set_all_boundary_ids(0);
+          else if(color < 2)
+            cell->face(f)->set_all_boundary_ids(color + 10);
+          else
+            cell->face(f)->set_all_boundary_ids(color - 2 + 10);
+        }
+      }
     }
 
     dealii::GridTools::collect_periodic_faces(
@@ -510,6 +547,9 @@ private:
     return pp;
   }
 
+  // number of coarse cells per direction (only the first dim entries are used)
+  std::array<unsigned int, 3> n_subdivisions = {{1, 1, 1}};
+
   // solver tolerances
   double const ABS_TOL = 1.e-12;
   double const REL_TOL = 1.e-3;
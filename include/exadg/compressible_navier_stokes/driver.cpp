@@ -67,7 +67,7 @@ Driver<dim, Number>::setup()
                                                          mpi_comm);
 
   // initialize matrix_free
-  matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>();
+  matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>(*application->get_grid());
   matrix_free_data->append(pde_operator);
 
   matrix_free = std::make_shared<dealii::MatrixFree<dim, Number>>();
@@ -27,7 +27,9 @@
 // ExaDG
 #include <exadg/convection_diffusion/driver.h>
 #include <exadg/convection_diffusion/time_integration/create_time_integrator.h>
+#include <exadg/grid/adaptive_mesh_refinement.h>
 #include <exadg/grid/get_dynamic_mapping.h>
+#include <exadg/grid/load_balancing.h>
 #include <exadg/utilities/print_solver_results.h>
 #include <exadg/utilities/throughput_parameters.h>
 
@@ -59,6 +61,11 @@ Driver<dim, Number>::setup()
   pcout << std::endl << "Setting up scalar convection-diffusion solver:" << std::endl;
 
   application->setup();
+  timer_tree.insert({"Convection-diffusion", "Setup", "Create grid"},
+                    application->get_wall_time_create_grid());
+
+  if(application->get_parameters().use_load_balancing)
+    setup_load_balancing();
 
   if(application->get_parameters().ale_formulation) // moving mesh
   {
@@ -82,7 +89,7 @@ Driver<dim, Number>::setup()
                                                          mpi_comm);
 
   // initialize matrix_free
-  matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>();
+  matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>(*application->get_grid());
   matrix_free_data->append(pde_operator);
 
   matrix_free = std::make_shared<dealii::MatrixFree<dim, Number>>();
@@ -190,6 +197,161 @@ Driver<dim, Number>::ale_update() const
   time_int_bdf->ale_update();
 }
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::setup_load_balancing() const
+{
+  Parameters const & param = application->get_parameters();
+
+  dealii::Triangulation<dim> & triangulation = *application->get_grid()->triangulation;
+
+  connect_cell_weight(triangulation,
+                      param.load_balancing_data,
+                      application->get_grid()->additional_cell_weight);
+
+  // the initial partitioning is based on the number of cells, no data needs to be transferred
+  // since the degrees of freedom have not been distributed yet
+  double const imbalance = compute_load_imbalance(triangulation,
+                                                  param.load_balancing_data,
+                                                  application->get_grid()->additional_cell_weight);
+
+  print_parameter(pcout, "Load imbalance of initial partitioning", imbalance);
+
+  if(imbalance > param.load_balancing_data.imbalance_tolerance)
+  {
+    dynamic_cast<dealii::parallel::distributed::Triangulation<dim> &>(triangulation).repartition();
+
+    print_parameter(pcout,
+                    "Load imbalance after repartitioning",
+                    compute_load_imbalance(triangulation,
+                                           param.load_balancing_data,
+                                           application->get_grid()->additional_cell_weight));
+  }
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::do_adaptive_mesh_refinement()
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  Parameters const & param = application->get_parameters();
+
+  dealii::Triangulation<dim> & triangulation = *application->get_grid()->triangulation;
+
+  std::shared_ptr<TimeIntBDF<dim, Number>> time_integrator_bdf =
+    std::dynamic_pointer_cast<TimeIntBDF<dim, Number>>(time_integrator);
+
+  pcout << std::endl
+        << "Adaptive mesh refinement at t = " << time_integrator->get_time() << ":" << std::endl;
+
+  // mark cells according to the refinement indicator of the current solution
+  dealii::Vector<float> indicators;
+  compute_refinement_indicator(indicators,
+                               pde_operator->get_dof_handler(),
+                               *pde_operator->get_mapping(),
+                               time_integrator_bdf->get_solution(),
+                               param.adaptive_mesh_refinement_data.refinement_indicator);
+
+  mark_cells_for_coarsening_and_refinement(triangulation,
+                                           indicators,
+                                           param.adaptive_mesh_refinement_data);
+
+  // adapt triangulation and transfer the solution vectors
+  time_integrator_bdf->prepare_coarsening_and_refinement();
+
+  triangulation.execute_coarsening_and_refinement();
+
+  print_parameter(pcout, "number of cells (total)", triangulation.n_global_active_cells());
+
+  setup_after_coarsening_and_refinement();
+
+  timer_tree.insert({"Convection-diffusion", "Adaptive mesh refinement"}, timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::do_repartitioning()
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  Parameters const & param = application->get_parameters();
+
+  dealii::Triangulation<dim> & triangulation = *application->get_grid()->triangulation;
+
+  double const imbalance = compute_load_imbalance(triangulation,
+                                                  param.load_balancing_data,
+                                                  application->get_grid()->additional_cell_weight);
+
+  if(imbalance > param.load_balancing_data.imbalance_tolerance)
+  {
+    pcout << std::endl
+          << "Repartitioning at t = " << time_integrator->get_time() << ":" << std::endl;
+
+    print_parameter(pcout, "Load imbalance before repartitioning", imbalance);
+
+    // repartition triangulation and transfer the solution vectors
+    std::shared_ptr<TimeIntBDF<dim, Number>> time_integrator_bdf =
+      std::dynamic_pointer_cast<TimeIntBDF<dim, Number>>(time_integrator);
+
+    time_integrator_bdf->prepare_coarsening_and_refinement();
+
+    dynamic_cast<dealii::parallel::distributed::Triangulation<dim> &>(triangulation).repartition();
+
+    setup_after_coarsening_and_refinement();
+
+    print_parameter(pcout,
+                    "Load imbalance after repartitioning",
+                    compute_load_imbalance(triangulation,
+                                           param.load_balancing_data,
+                                           application->get_grid()->additional_cell_weight));
+  }
+
+  timer_tree.insert({"Convection-diffusion", "Repartitioning"}, timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::setup_after_coarsening_and_refinement()
+{
+  Parameters const & param = application->get_parameters();
+
+  std::shared_ptr<TimeIntBDF<dim, Number>> time_integrator_bdf =
+    std::dynamic_pointer_cast<TimeIntBDF<dim, Number>>(time_integrator);
+
+  pde_operator->distribute_dofs();
+
+  // set up data structures depending on the degrees of freedom
+  if(param.use_cell_based_face_loops)
+    Categorization::do_cell_based_loops(*application->get_grid()->triangulation,
+                                        matrix_free_data->data);
+  matrix_free->reinit(*pde_operator->get_mapping(),
+                      matrix_free_data->get_dof_handler_vector(),
+                      matrix_free_data->get_constraint_vector(),
+                      matrix_free_data->get_quadrature_vector(),
+                      matrix_free_data->data);
+
+  pde_operator->setup(matrix_free, matrix_free_data);
+
+  time_integrator_bdf->interpolate_after_coarsening_and_refinement();
+
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+  VectorType const *                                         velocity_ptr = nullptr;
+  VectorType                                                 velocity;
+
+  if(param.get_type_velocity_field() == TypeVelocityField::DoFVector)
+  {
+    pde_operator->initialize_dof_vector_velocity(velocity);
+    pde_operator->interpolate_velocity(velocity, time_integrator->get_time());
+    velocity_ptr = &velocity;
+  }
+
+  pde_operator->setup_solver(time_integrator_bdf->get_scaling_factor_time_derivative_term(),
+                             velocity_ptr);
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::solve()
@@ -209,6 +371,25 @@ Driver<dim, Number>::solve()
         time_integrator->advance_one_timestep_post_solve();
       } while(!time_integrator->finished());
     }
+    else if(application->get_parameters().use_adaptive_mesh_refinement or
+            application->get_parameters().use_load_balancing)
+    {
+      Parameters const & param = application->get_parameters();
+
+      while(!time_integrator->finished())
+      {
+        unsigned int const n_time_steps = time_integrator->get_number_of_time_steps();
+
+        if(param.use_adaptive_mesh_refinement and
+           param.adaptive_mesh_refinement_data.do_coarsening_and_refinement(n_time_steps))
+          do_adaptive_mesh_refinement();
+
+        if(param.use_load_balancing and param.load_balancing_data.do_repartitioning(n_time_steps))
+          do_repartitioning();
+
+        time_integrator->advance_one_timestep();
+      }
+    }
     else
     {
       time_integrator->timeloop();
@@ -102,6 +102,35 @@ private:
   void
   ale_update() const;
 
+  /*
+   * Adapts the triangulation according to the refinement indicator of the current solution,
+   * transfers the solution vectors of the time integrator, and sets up all data structures
+   * depending on the degrees of freedom again.
+   */
+  void
+  do_adaptive_mesh_refinement();
+
+  /*
+   * Attaches the modeled cell weights to the triangulation and repartitions the triangulation
+   * before the degrees of freedom are distributed if the initial partitioning is imbalanced.
+   */
+  void
+  setup_load_balancing() const;
+
+  /*
+   * Repartitions the triangulation if the imbalance of the modeled cost exceeds the tolerance and
+   * migrates the solution vectors of the time integrator.
+   */
+  void
+  do_repartitioning();
+
+  /*
+   * Distributes the degrees of freedom and sets up all data structures depending on them after the
+   * triangulation has been changed.
+   */
+  void
+  setup_after_coarsening_and_refinement();
+
   // MPI communicator
   MPI_Comm const mpi_comm;
 
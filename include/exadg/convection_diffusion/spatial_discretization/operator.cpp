@@ -31,6 +31,7 @@
 #include <exadg/solvers_and_preconditioners/preconditioners/block_jacobi_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/inverse_mass_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
+#include <exadg/solvers_and_preconditioners/solvers/batched_krylov_solvers.h>
 #include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
 #include <exadg/time_integration/time_step_calculation.h>
 
@@ -230,6 +231,8 @@ Operator<dim, Number>::setup(std::shared_ptr<dealii::MatrixFree<dim, Number>> ma
     combined_operator_data.solver_block_diagonal         = param.solver_block_diagonal;
     combined_operator_data.preconditioner_block_diagonal = param.preconditioner_block_diagonal;
     combined_operator_data.solver_data_block_diagonal    = param.solver_data_block_diagonal;
+    combined_operator_data.use_mixed_precision_block_diagonal =
+      param.use_mixed_precision_block_diagonal;
 
     // linear system of equations has to be solved: the problem is either steady or
     // an unsteady problem is solved with BDF time integration (semi-implicit or fully implicit
@@ -524,6 +527,14 @@ Operator<dim, Number>::initialize_solver()
     iterative_solver = std::make_shared<
       Krylov::SolverCG<CombinedOperator<dim, Number>, PreconditionerBase<Number>, VectorType>>(
       combined_operator, *preconditioner, solver_data);
+
+    if(param.solve_batched)
+    {
+      batched_solver = std::make_shared<Krylov::SolverCGBatched<CombinedOperator<dim, Number>,
+                                                                PreconditionerBase<Number>,
+                                                                BlockVectorType>>(
+        combined_operator, *preconditioner, solver_data);
+    }
   }
   else if(param.solver == Solver::GMRES)
   {
@@ -869,6 +880,27 @@ Operator<dim, Number>::solve(VectorType &       sol,
   return iterations;
 }
 
+template<int dim, typename Number>
+unsigned int
+Operator<dim, Number>::solve_batched(BlockVectorType &       sol,
+                                     BlockVectorType const & rhs,
+                                     bool const              update_preconditioner,
+                                     double const            scaling_factor,
+                                     double const            time,
+                                     VectorType const *      velocity)
+{
+  AssertThrow(batched_solver.get() != nullptr,
+              dealii::ExcMessage("Batched solver has not been initialized, set solve_batched."));
+
+  update_conv_diff_operator(time, scaling_factor, velocity);
+
+  batched_solver->update_preconditioner(update_preconditioner);
+
+  unsigned int const iterations = batched_solver->solve(sol, rhs);
+
+  return iterations;
+}
+
 template<int dim, typename Number>
 double
 Operator<dim, Number>::calculate_time_step_cfl_global(double const time) const
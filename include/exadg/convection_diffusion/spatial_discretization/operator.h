@@ -51,6 +51,8 @@ private:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
 public:
+  typedef dealii::LinearAlgebra::distributed::BlockVector<Number> BlockVectorType;
+
   /*
    * Constructor.
    */
@@ -219,6 +221,14 @@ public:
   void
   update_after_grid_motion();
 
+  /*
+   * Initializes dealii::DoFHandlers. Apart from the constructor, this function is called after the
+   * triangulation has been changed by adaptive mesh refinement, in which case the MatrixFree
+   * object has to be reinitialized and setup() and setup_solver() have to be called again.
+   */
+  void
+  distribute_dofs();
+
   /*
    * This function solves the linear system of equations in case of implicit time integration or
    * steady-state problems (potentially involving the mass, convective, and diffusive
@@ -232,6 +242,22 @@ public:
         double const       time           = -1.0,
         VectorType const * velocity       = nullptr);
 
+  /*
+   * Solves the linear systems of several scalar fields sharing this operator at once, where the
+   * solutions and right-hand sides of the individual fields are stored as blocks of a block
+   * vector. The vectors of all fields need to be compatible with the vectors of this operator,
+   * i.e., the fields need to be discretized with the same finite element on the same
+   * triangulation. Only available if Parameters::solve_batched is set. Returns the maximum number
+   * of iterations over all fields.
+   */
+  unsigned int
+  solve_batched(BlockVectorType &       sol,
+                BlockVectorType const & rhs,
+                bool const              update_preconditioner,
+                double const            scaling_factor,
+                double const            time,
+                VectorType const *      velocity = nullptr);
+
   /*
    * Calculate time step size according to maximum efficiency criterion
    */
@@ -302,12 +328,6 @@ private:
   double
   calculate_minimum_element_length() const;
 
-  /*
-   * Initializes dealii::DoFHandlers.
-   */
-  void
-  distribute_dofs();
-
   bool
   needs_own_dof_handler_velocity() const;
 
@@ -418,6 +438,9 @@ private:
   std::shared_ptr<PreconditionerBase<Number>>     preconditioner;
   std::shared_ptr<Krylov::SolverBase<VectorType>> iterative_solver;
 
+  // solver for several right-hand sides (scalar fields) at once
+  std::shared_ptr<Krylov::SolverBase<BlockVectorType>> batched_solver;
+
   /*
    * MPI
    */
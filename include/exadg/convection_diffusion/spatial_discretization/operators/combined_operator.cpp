@@ -158,6 +158,25 @@ CombinedOperator<dim, Number>::set_scaling_factor_mass_operator(Number const & s
   scaling_factor_mass = scaling_factor;
 }
 
+template<int dim, typename Number>
+Elementwise::TensorProductCoefficients
+CombinedOperator<dim, Number>::get_tensor_product_coefficients() const
+{
+  // the convective term is neglected
+  Elementwise::TensorProductCoefficients coefficients;
+
+  if(operator_data.unsteady_problem)
+    coefficients.mass_factor = scaling_factor_mass;
+
+  if(operator_data.diffusive_problem)
+  {
+    coefficients.diffusivity = operator_data.diffusive_kernel_data.diffusivity;
+    coefficients.IP_factor   = operator_data.diffusive_kernel_data.IP_factor;
+  }
+
+  return coefficients;
+}
+
 template<int dim, typename Number>
 void
 CombinedOperator<dim, Number>::reinit_cell(unsigned int const cell) const
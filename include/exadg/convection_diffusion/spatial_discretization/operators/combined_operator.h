@@ -104,6 +104,9 @@ public:
   void
   set_scaling_factor_mass_operator(Number const & scaling_factor);
 
+  Elementwise::TensorProductCoefficients
+  get_tensor_product_coefficients() const;
+
 private:
   void
   reinit_cell(unsigned int const cell) const;
@@ -419,14 +419,9 @@ TimeIntBDF<dim, Number>::write_restart_vectors(boost::archive::binary_oarchive &
 
 template<int dim, typename Number>
 void
-TimeIntBDF<dim, Number>::do_timestep_solve()
+TimeIntBDF<dim, Number>::assemble_linear_system()
 {
-  dealii::Timer timer;
-  timer.restart();
-
   // transport velocity
-  VectorType velocity_np;
-
   if(param.convective_problem())
   {
     if(param.get_type_velocity_field() == TypeVelocityField::DoFVector)
@@ -496,20 +491,20 @@ TimeIntBDF<dim, Number>::do_timestep_solve()
   solution_np.equ(this->extra.get_beta(0), solution[0]);
   for(unsigned int i = 1; i < solution.size(); ++i)
     solution_np.add(this->extra.get_beta(i), solution[i]);
+}
 
-  // solve the linear system of equations
-  bool const update_preconditioner =
-    this->param.update_preconditioner &&
-    (this->time_step_number % this->param.update_preconditioner_every_time_steps == 0);
-
-  unsigned int const N_iter =
-    pde_operator->solve(solution_np,
-                        rhs_vector,
-                        update_preconditioner,
-                        this->bdf.get_gamma0() / this->get_time_step_size(),
-                        this->get_next_time(),
-                        &velocity_np);
+template<int dim, typename Number>
+bool
+TimeIntBDF<dim, Number>::update_preconditioner_in_current_time_step() const
+{
+  return this->param.update_preconditioner &&
+         (this->time_step_number % this->param.update_preconditioner_every_time_steps == 0);
+}
 
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::update_after_linear_solve(unsigned int const N_iter)
+{
   iterations.first += 1;
   iterations.second += N_iter;
 
@@ -535,14 +530,112 @@ TimeIntBDF<dim, Number>::do_timestep_solve()
       }
     }
   }
+}
 
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::print_solver_info_and_update_timer(unsigned int const N_iter,
+                                                            double const       wall_time) const
+{
   if(print_solver_info() and not(this->is_test))
   {
     this->pcout << std::endl << "Solve scalar convection-diffusion equation:";
-    print_solver_info_linear(this->pcout, N_iter, timer.wall_time());
+    print_solver_info_linear(this->pcout, N_iter, wall_time);
+  }
+
+  this->timer_tree->insert({"Timeloop", "Solve"}, wall_time);
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::do_timestep_solve()
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  assemble_linear_system();
+
+  // solve the linear system of equations
+  unsigned int const N_iter =
+    pde_operator->solve(solution_np,
+                        rhs_vector,
+                        update_preconditioner_in_current_time_step(),
+                        this->bdf.get_gamma0() / this->get_time_step_size(),
+                        this->get_next_time(),
+                        &velocity_np);
+
+  update_after_linear_solve(N_iter);
+
+  print_solver_info_and_update_timer(N_iter, timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::advance_one_timestep_solve_batched(
+  std::vector<std::shared_ptr<TimeIntBDF<dim, Number>>> const & time_integrators)
+{
+  AssertThrow(time_integrators.size() > 0,
+              dealii::ExcMessage("Batched solution requires at least one time integrator."));
+
+  TimeIntBDF<dim, Number> const & first = *time_integrators[0];
+
+  // the time integrators are synchronized so that it suffices to check the first one
+  if(not(first.started()) or first.finished())
+    return;
+
+  dealii::Timer timer;
+  timer.restart();
+
+  unsigned int const n_fields = time_integrators.size();
+
+  typename Operator<dim, Number>::BlockVectorType solution_batched(n_fields), rhs_batched(n_fields);
+
+  for(unsigned int i = 0; i < n_fields; ++i)
+  {
+    TimeIntBDF<dim, Number> & time_integrator = *time_integrators[i];
+
+    AssertThrow(std::abs(time_integrator.get_next_time() - first.get_next_time()) <
+                    1.e-12 * time_integrator.param.end_time and
+                  std::abs(time_integrator.get_scaling_factor_time_derivative_term() -
+                           first.get_scaling_factor_time_derivative_term()) <
+                    1.e-12 * first.get_scaling_factor_time_derivative_term(),
+                dealii::ExcMessage("Time integrators of batched solution are not synchronized."));
+
+    time_integrator.assemble_linear_system();
+
+    solution_batched.block(i).reinit(time_integrator.solution_np, true);
+    solution_batched.block(i) = time_integrator.solution_np;
+    rhs_batched.block(i).reinit(time_integrator.rhs_vector, true);
+    rhs_batched.block(i) = time_integrator.rhs_vector;
   }
+  solution_batched.collect_sizes();
+  rhs_batched.collect_sizes();
+
+  // solve the linear systems of all fields with the operator of the first field
+  unsigned int const N_iter =
+    first.pde_operator->solve_batched(solution_batched,
+                                      rhs_batched,
+                                      first.update_preconditioner_in_current_time_step(),
+                                      first.get_scaling_factor_time_derivative_term(),
+                                      first.get_next_time(),
+                                      &first.velocity_np);
+
+  for(unsigned int i = 0; i < n_fields; ++i)
+  {
+    TimeIntBDF<dim, Number> & time_integrator = *time_integrators[i];
 
-  this->timer_tree->insert({"Timeloop", "Solve"}, timer.wall_time());
+    time_integrator.solution_np = solution_batched.block(i);
+
+    time_integrator.update_after_linear_solve(N_iter);
+  }
+
+  // the wall time of the batched solution is distributed equally among the time integrators
+  double const wall_time = timer.wall_time() / (double)n_fields;
+  for(unsigned int i = 0; i < n_fields; ++i)
+  {
+    time_integrators[i]->print_solver_info_and_update_timer(N_iter, wall_time);
+    time_integrators[i]->timer_tree->insert({"Timeloop"}, wall_time);
+  }
 }
 
 template<int dim, typename Number>
@@ -578,6 +671,85 @@ TimeIntBDF<dim, Number>::print_iterations() const
   print_list_of_iterations(this->pcout, names, iterations_avg);
 }
 
+template<int dim, typename Number>
+typename TimeIntBDF<dim, Number>::VectorType const &
+TimeIntBDF<dim, Number>::get_solution() const
+{
+  return solution[0];
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::prepare_coarsening_and_refinement()
+{
+  std::vector<VectorType const *> vectors;
+  for(unsigned int i = 0; i < solution.size(); ++i)
+  {
+    solution[i].update_ghost_values();
+    vectors.push_back(&solution[i]);
+  }
+
+  solution_transfer =
+    std::make_shared<dealii::parallel::distributed::SolutionTransfer<dim, VectorType>>(
+      pde_operator->get_dof_handler());
+  solution_transfer->prepare_for_coarsening_and_refinement(vectors);
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::interpolate_after_coarsening_and_refinement()
+{
+  AssertThrow(solution_transfer.get() != nullptr,
+              dealii::ExcMessage("prepare_coarsening_and_refinement() has not been called."));
+
+  allocate_vectors();
+
+  std::vector<VectorType *> vectors;
+  for(unsigned int i = 0; i < solution.size(); ++i)
+    vectors.push_back(&solution[i]);
+
+  solution_transfer->interpolate(vectors);
+  solution_transfer.reset();
+
+  for(unsigned int i = 0; i < solution.size(); ++i)
+    solution[i].zero_out_ghost_values();
+
+  // the convective term is not transferred but evaluated for the transferred solutions
+  if(param.convective_problem() &&
+     param.treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit)
+  {
+    recompute_vec_convective_term();
+  }
+
+  // the CFL condition changes with the element size
+  if(this->adaptive_time_stepping)
+    this->set_current_time_step_size(recalculate_time_step_size());
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::recompute_vec_convective_term()
+{
+  VectorType velocity;
+  if(param.get_type_velocity_field() == TypeVelocityField::DoFVector)
+    pde_operator->initialize_dof_vector_velocity(velocity);
+
+  for(unsigned int i = 0; i < vec_convective_term.size(); ++i)
+  {
+    double const time = this->get_previous_time(i);
+
+    if(param.get_type_velocity_field() == TypeVelocityField::DoFVector)
+    {
+      pde_operator->project_velocity(velocity, time);
+      pde_operator->evaluate_convective_term(vec_convective_term[i], solution[i], time, &velocity);
+    }
+    else
+    {
+      pde_operator->evaluate_convective_term(vec_convective_term[i], solution[i], time);
+    }
+  }
+}
+
 template<int dim, typename Number>
 void
 TimeIntBDF<dim, Number>::set_velocities_and_times(
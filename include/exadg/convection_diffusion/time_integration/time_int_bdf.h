@@ -23,6 +23,7 @@
 #define INCLUDE_CONVECTION_DIFFUSION_TIME_INT_BDF_H_
 
 // deal.II
+#include <deal.II/distributed/solution_transfer.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
@@ -69,6 +70,32 @@ public:
   void
   print_iterations() const;
 
+  VectorType const &
+  get_solution() const;
+
+  /*
+   * Adaptive mesh refinement and repartitioning: The solution vectors at previous instants of time
+   * are transferred to the adapted triangulation. prepare_coarsening_and_refinement() has to be
+   * called before the triangulation is changed, interpolate_after_coarsening_and_refinement() after
+   * the degrees of freedom have been distributed and the operator has been set up on the adapted
+   * triangulation.
+   */
+  void
+  prepare_coarsening_and_refinement();
+
+  void
+  interpolate_after_coarsening_and_refinement();
+
+  /*
+   * Solves the current time step of several scalar fields at once by a batched linear solver,
+   * see Operator::solve_batched(). The time integrators need to be synchronized and the
+   * operator of the first time integrator is used for all fields. This function replaces
+   * advance_one_timestep_solve() for the time integrators involved.
+   */
+  static void
+  advance_one_timestep_solve_batched(
+    std::vector<std::shared_ptr<TimeIntBDF<dim, Number>>> const & time_integrators);
+
 private:
   void
   allocate_vectors() final;
@@ -82,6 +109,10 @@ private:
   void
   initialize_vec_convective_term();
 
+  // evaluates the convective term for the solutions at all previous instants of time
+  void
+  recompute_vec_convective_term();
+
   double
   calculate_time_step_size() final;
 
@@ -94,6 +125,21 @@ private:
   void
   do_timestep_solve() final;
 
+  // computes the transport velocity, the right-hand side vector, and the initial guess for the
+  // linear system of equations of the current time step
+  void
+  assemble_linear_system();
+
+  bool
+  update_preconditioner_in_current_time_step() const;
+
+  // updates iteration counts and the convective term after the linear system has been solved
+  void
+  update_after_linear_solve(unsigned int const N_iter);
+
+  void
+  print_solver_info_and_update_timer(unsigned int const N_iter, double const wall_time) const;
+
   void
   setup_derived() final;
 
@@ -125,6 +171,9 @@ private:
 
   VectorType rhs_vector;
 
+  // transport velocity at time t_{n+1}
+  VectorType velocity_np;
+
   // numerical velocity field
   std::vector<VectorType const *> velocities;
   std::vector<double>             times;
@@ -139,6 +188,10 @@ private:
   VectorType              grid_velocity;
   std::vector<VectorType> vec_grid_coordinates;
   VectorType              grid_coordinates_np;
+
+  // adaptive mesh refinement and repartitioning
+  std::shared_ptr<dealii::parallel::distributed::SolutionTransfer<dim, VectorType>>
+    solution_transfer;
 };
 
 } // namespace ConvDiff
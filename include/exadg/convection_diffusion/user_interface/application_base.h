@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_CONVECTION_DIFFUSION_USER_INTERFACE_APPLICATION_BASE_H_
 
 // deal.II
+#include <deal.II/base/timer.h>
 #include <deal.II/distributed/tria.h>
 #include <deal.II/grid/grid_generator.h>
 
@@ -52,7 +53,8 @@ public:
     : mpi_comm(comm),
       pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0),
       parameter_file(parameter_file),
-      n_subdivisions_1d_hypercube(1)
+      n_subdivisions_1d_hypercube(1),
+      wall_time_create_grid(0.0)
   {
     grid = std::make_shared<Grid<dim>>();
   }
@@ -92,8 +94,10 @@ public:
     param.print(pcout, "List of parameters:");
 
     // grid
+    dealii::Timer timer;
     grid->initialize(param.grid, mpi_comm);
     create_grid();
+    wall_time_create_grid = timer.wall_time();
     print_grid_info(pcout, *grid);
 
     // boundary conditions
@@ -130,6 +134,12 @@ public:
     return grid;
   }
 
+  double
+  get_wall_time_create_grid() const
+  {
+    return wall_time_create_grid;
+  }
+
   std::shared_ptr<BoundaryDescriptor<dim> const>
   get_boundary_descriptor() const
   {
@@ -168,6 +178,9 @@ protected:
 
   OutputParameters output_parameters;
 
+  // wall time of the grid creation (including the partitioning of the triangulation)
+  double wall_time_create_grid;
+
 private:
   virtual void
   set_parameters() = 0;
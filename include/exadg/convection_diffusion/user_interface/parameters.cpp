@@ -69,10 +69,15 @@ Parameters::Parameters()
     degree(1),
     numerical_flux_convective_operator(NumericalFluxConvectiveOperator::Undefined),
     IP_factor(1.0),
+    use_adaptive_mesh_refinement(false),
+    adaptive_mesh_refinement_data(AdaptiveMeshRefinementData()),
+    use_load_balancing(false),
+    load_balancing_data(LoadBalancingData()),
 
     // SOLVER
     solver(Solver::Undefined),
     solver_data(SolverData(1e4, 1.e-12, 1.e-6, 100)),
+    solve_batched(false),
     preconditioner(Preconditioner::Undefined),
     update_preconditioner(false),
     update_preconditioner_every_time_steps(1),
@@ -80,6 +85,7 @@ Parameters::Parameters()
     solver_block_diagonal(Elementwise::Solver::Undefined),
     preconditioner_block_diagonal(Elementwise::Preconditioner::InverseMassMatrix),
     solver_data_block_diagonal(SolverData(1000, 1.e-12, 1.e-2, 1000)),
+    use_mixed_precision_block_diagonal(false),
     mg_operator_type(MultigridOperatorType::Undefined),
     multigrid_data(MultigridData()),
     solver_info_data(SolverInfoData()),
@@ -264,6 +270,51 @@ Parameters::check() const
                 dealii::ExcMessage("parameter must be defined"));
   }
 
+  if(use_adaptive_mesh_refinement)
+    adaptive_mesh_refinement_data.check();
+
+  if(use_load_balancing)
+    load_balancing_data.check();
+
+  // the triangulation is changed during the time loop
+  if(use_adaptive_mesh_refinement or use_load_balancing)
+  {
+    AssertThrow(problem_type == ProblemType::Unsteady and
+                  temporal_discretization == TemporalDiscretization::BDF,
+                dealii::ExcMessage("Adaptive mesh refinement and repartitioning are only "
+                                   "implemented for unsteady problems solved with BDF time "
+                                   "integration."));
+
+    AssertThrow(ale_formulation == false,
+                dealii::ExcMessage("Adaptive mesh refinement and repartitioning can not be "
+                                   "combined with the ALE formulation."));
+
+    AssertThrow(analytical_velocity_field,
+                dealii::ExcMessage("Adaptive mesh refinement and repartitioning require an "
+                                   "analytical velocity field."));
+
+    AssertThrow(grid.triangulation_type == TriangulationType::Distributed,
+                dealii::ExcMessage("Adaptive mesh refinement and repartitioning require "
+                                   "TriangulationType::Distributed."));
+
+    AssertThrow(not(involves_h_multigrid() and
+                    grid.multigrid == MultigridVariant::GlobalCoarsening),
+                dealii::ExcMessage("Adaptive mesh refinement and repartitioning in combination "
+                                   "with h-multigrid require MultigridVariant::LocalSmoothing, "
+                                   "since the coarse triangulations of global coarsening are "
+                                   "created only once."));
+  }
+
+  // MultigridVariant::LocalSmoothing does not support hanging nodes, and the coarse
+  // triangulations of MultigridVariant::GlobalCoarsening are not recreated after refinement
+  if(use_adaptive_mesh_refinement)
+  {
+    AssertThrow(not(linear_system_has_to_be_solved() and
+                    preconditioner == Preconditioner::Multigrid),
+                dealii::ExcMessage("Adaptive mesh refinement can not be combined with a multigrid "
+                                   "preconditioner. Use a single-level preconditioner instead."));
+  }
+
 
   // SOLVER
   if(temporal_discretization == TemporalDiscretization::BDF)
@@ -310,6 +361,20 @@ Parameters::check() const
                 dealii::ExcMessage("Not implemented"));
   }
 
+  if(solve_batched)
+  {
+    AssertThrow(temporal_discretization == TemporalDiscretization::BDF and solver == Solver::CG,
+                dealii::ExcMessage("Batched solution requires BDF time integration and CG."));
+
+    AssertThrow(not(convective_problem()) or
+                  treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit,
+                dealii::ExcMessage(
+                  "Batched solution requires the convective term to be treated explicitly."));
+
+    AssertThrow(ale_formulation == false,
+                dealii::ExcMessage("Batched solution is not implemented for ALE formulation."));
+  }
+
   if(implement_block_diagonal_preconditioner_matrix_free)
   {
     AssertThrow(
@@ -515,6 +580,16 @@ Parameters::print_parameters_spatial_discretization(dealii::ConditionalOStream c
   {
     print_parameter(pcout, "IP factor viscous term", IP_factor);
   }
+
+  print_parameter(pcout, "Adaptive mesh refinement", use_adaptive_mesh_refinement);
+
+  if(use_adaptive_mesh_refinement)
+    adaptive_mesh_refinement_data.print(pcout);
+
+  print_parameter(pcout, "Cost-weighted repartitioning", use_load_balancing);
+
+  if(use_load_balancing)
+    load_balancing_data.print(pcout);
 }
 
 void
@@ -526,6 +601,9 @@ Parameters::print_parameters_solver(dealii::ConditionalOStream const & pcout) co
 
   solver_data.print(pcout);
 
+  if(solver == Solver::CG)
+    print_parameter(pcout, "Solve batched", solve_batched);
+
   print_parameter(pcout, "Preconditioner", preconditioner);
 
   if(preconditioner != Preconditioner::None)
@@ -546,6 +624,13 @@ Parameters::print_parameters_solver(dealii::ConditionalOStream const & pcout) co
 
     print_parameter(pcout, "Preconditioner block diagonal", preconditioner_block_diagonal);
 
+    if(preconditioner_block_diagonal == Elementwise::Preconditioner::FastDiagonalization)
+    {
+      print_parameter(pcout,
+                      "Mixed precision block diagonal",
+                      use_mixed_precision_block_diagonal);
+    }
+
     solver_data_block_diagonal.print(pcout);
   }
 
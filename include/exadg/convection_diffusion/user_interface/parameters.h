@@ -27,8 +27,10 @@
 
 // ExaDG
 #include <exadg/convection_diffusion/user_interface/enum_types.h>
+#include <exadg/grid/adaptive_mesh_refinement_data.h>
 #include <exadg/grid/enum_types.h>
 #include <exadg/grid/grid_data.h>
+#include <exadg/grid/load_balancing_data.h>
 #include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/enum_types.h>
 #include <exadg/solvers_and_preconditioners/solvers/enum_types.h>
@@ -237,6 +239,20 @@ public:
   // interior penalty parameter scaling factor: default value is 1.0
   double IP_factor;
 
+  // adapt the triangulation dynamically during the time loop according to a refinement
+  // indicator evaluated for the current solution
+  bool use_adaptive_mesh_refinement;
+
+  // description: see declaration of AdaptiveMeshRefinementData
+  AdaptiveMeshRefinementData adaptive_mesh_refinement_data;
+
+  // repartition the triangulation periodically during the time loop such that the modeled cost of
+  // the cells is distributed evenly among the MPI processes
+  bool use_load_balancing;
+
+  // description: see declaration of LoadBalancingData
+  LoadBalancingData load_balancing_data;
+
 
 
   /**************************************************************************************/
@@ -251,6 +267,14 @@ public:
   // solver data
   SolverData solver_data;
 
+  // In case of several scalar fields sharing the same spatial discretization, the linear systems
+  // of these fields can be solved simultaneously, i.e., the operator is applied to all fields in
+  // one loop over the mesh and the global reductions of the Krylov solver are combined. This
+  // requires that all scalar fields with this option enabled use identical parameters (apart
+  // from the initial and boundary data). Currently only implemented for the CG solver and
+  // BDF time integration with the convective term treated explicitly.
+  bool solve_batched;
+
   // description: see enum declaration
   Preconditioner preconditioner;
 
@@ -276,6 +300,10 @@ public:
   // iterative solution procedure)
   SolverData solver_data_block_diagonal;
 
+  // store the data of the elementwise preconditioner in single precision (only relevant
+  // for Elementwise::Preconditioner::FastDiagonalization)
+  bool use_mixed_precision_block_diagonal;
+
   // description: see enum declaration
   MultigridOperatorType mg_operator_type;
 
@@ -137,7 +137,7 @@ SolverFluid<dim, Number>::setup(std::shared_ptr<FluidFSI::ApplicationBase<dim, N
   }
 
   // ALE: initialize matrix_free_data
-  ale_matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>();
+  ale_matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>(*application->get_grid());
 
   if(application->get_parameters().mesh_movement_type == IncNS::MeshMovementType::Poisson)
   {
@@ -183,16 +183,18 @@ SolverFluid<dim, Number>::setup(std::shared_ptr<FluidFSI::ApplicationBase<dim, N
   // ALE: create grid motion object
   if(application->get_parameters().mesh_movement_type == IncNS::MeshMovementType::Poisson)
   {
-    ale_grid_motion =
-      std::make_shared<GridMotionPoisson<dim, Number>>(application->get_grid()->mapping,
-                                                       ale_poisson_operator);
+    ale_grid_motion = std::make_shared<GridMotionPoisson<dim, Number>>(
+      application->get_grid()->mapping,
+      ale_poisson_operator,
+      application->get_parameters().mesh_movement_tolerance);
   }
   else if(application->get_parameters().mesh_movement_type == IncNS::MeshMovementType::Elasticity)
   {
     ale_grid_motion = std::make_shared<GridMotionElasticity<dim, Number>>(
       application->get_grid()->mapping,
       ale_elasticity_operator,
-      application->get_parameters_ale_elasticity());
+      application->get_parameters_ale_elasticity(),
+      application->get_parameters().mesh_movement_tolerance);
   }
   else
   {
@@ -209,7 +211,7 @@ SolverFluid<dim, Number>::setup(std::shared_ptr<FluidFSI::ApplicationBase<dim, N
                                                      mpi_comm);
 
   // initialize matrix_free
-  matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>();
+  matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>(*application->get_grid());
   matrix_free_data->append(pde_operator);
 
   matrix_free = std::make_shared<dealii::MatrixFree<dim, Number>>();
@@ -258,19 +260,24 @@ SolverFluid<dim, Number>::solve_ale(
   dealii::Timer sub_timer;
 
   sub_timer.restart();
-  bool const print_solver_info = time_integrator->print_solver_info();
-  ale_grid_motion->update(time_integrator->get_next_time(), print_solver_info and not(is_test));
+  bool const print_solver_info   = time_integrator->print_solver_info();
+  bool const mapping_has_changed = ale_grid_motion->update(time_integrator->get_next_time(),
+                                                           print_solver_info and not(is_test));
   timer_tree->insert({"ALE", "Solve and reinit mapping"}, sub_timer.wall_time());
 
-  sub_timer.restart();
-  std::shared_ptr<dealii::Mapping<dim> const> mapping =
-    get_dynamic_mapping<dim, Number>(application->get_grid(), ale_grid_motion);
-  matrix_free->update_mapping(*mapping);
-  timer_tree->insert({"ALE", "Update matrix-free"}, sub_timer.wall_time());
-
-  sub_timer.restart();
-  pde_operator->update_after_grid_motion();
-  timer_tree->insert({"ALE", "Update operator"}, sub_timer.wall_time());
+  // geometry-dependent data structures only need to be updated if the mesh has moved
+  if(mapping_has_changed)
+  {
+    sub_timer.restart();
+    std::shared_ptr<dealii::Mapping<dim> const> mapping =
+      get_dynamic_mapping<dim, Number>(application->get_grid(), ale_grid_motion);
+    matrix_free->update_mapping(*mapping);
+    timer_tree->insert({"ALE", "Update matrix-free"}, sub_timer.wall_time());
+
+    sub_timer.restart();
+    pde_operator->update_after_grid_motion();
+    timer_tree->insert({"ALE", "Update operator"}, sub_timer.wall_time());
+  }
 
   sub_timer.restart();
   time_integrator->ale_update();
@@ -0,0 +1,241 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_GRID_ADAPTIVE_MESH_REFINEMENT_H_
+#define INCLUDE_EXADG_GRID_ADAPTIVE_MESH_REFINEMENT_H_
+
+// C/C++
+#include <cmath>
+#include <map>
+
+// deal.II
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/distributed/grid_refinement.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/fe_interface_values.h>
+#include <deal.II/fe/mapping.h>
+#include <deal.II/grid/grid_refinement.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/vector.h>
+#include <deal.II/numerics/error_estimator.h>
+
+// ExaDG
+#include <exadg/grid/adaptive_mesh_refinement_data.h>
+
+namespace ExaDG
+{
+/*
+ * Computes the refinement indicator
+ *
+ *   eta_K^2 = sum_{F in faces(K)} 1/h_F * || [u] ||^2_{L2(F)}
+ *
+ * for all locally owned cells from the jumps of the discontinuous solution across interior faces.
+ * This is the jump contribution of residual-based error estimators for interior penalty DG
+ * methods. Faces at the boundary (including periodic boundaries) do not contribute.
+ */
+template<int dim, typename Number>
+void
+compute_refinement_indicator_jump_values(
+  dealii::Vector<float> &                                    indicators,
+  dealii::DoFHandler<dim> const &                            dof_handler,
+  dealii::Mapping<dim> const &                               mapping,
+  dealii::LinearAlgebra::distributed::Vector<Number> const & solution_relevant)
+{
+  dealii::FiniteElement<dim> const & fe = dof_handler.get_fe();
+
+  dealii::FEInterfaceValues<dim> fe_interface_values(mapping,
+                                                     fe,
+                                                     dealii::QGauss<dim - 1>(fe.degree + 1),
+                                                     dealii::update_values |
+                                                       dealii::update_JxW_values);
+
+  unsigned int const n_q_points = fe_interface_values.get_quadrature().size();
+
+  std::vector<dealii::Vector<Number>> values_m(n_q_points,
+                                               dealii::Vector<Number>(fe.n_components()));
+  std::vector<dealii::Vector<Number>> values_p(n_q_points,
+                                               dealii::Vector<Number>(fe.n_components()));
+
+  auto const integrate_jump = [&]() {
+    fe_interface_values.get_fe_face_values(0).get_function_values(solution_relevant, values_m);
+    fe_interface_values.get_fe_face_values(1).get_function_values(solution_relevant, values_p);
+
+    double jump_squared = 0.0, face_measure = 0.0;
+    for(unsigned int q = 0; q < n_q_points; ++q)
+    {
+      double const JxW = fe_interface_values.get_fe_face_values(0).JxW(q);
+      for(unsigned int c = 0; c < fe.n_components(); ++c)
+        jump_squared += dealii::Utilities::fixed_power<2>(values_m[q][c] - values_p[q][c]) * JxW;
+      face_measure += JxW;
+    }
+
+    double const h_F = std::pow(face_measure, 1.0 / (dim - 1));
+
+    return jump_squared / h_F;
+  };
+
+  indicators.reinit(dof_handler.get_triangulation().n_active_cells());
+
+  for(auto const & cell : dof_handler.active_cell_iterators())
+  {
+    if(not cell->is_locally_owned())
+      continue;
+
+    double eta_squared = 0.0;
+    for(unsigned int const f : cell->face_indices())
+    {
+      if(cell->at_boundary(f))
+        continue;
+
+      if(cell->face(f)->has_children())
+      {
+        // the neighbor is finer: integrate over all subfaces
+        unsigned int const face_no_neighbor = cell->neighbor_of_neighbor(f);
+        for(unsigned int subface = 0; subface < cell->face(f)->n_children(); ++subface)
+        {
+          fe_interface_values.reinit(cell,
+                                     f,
+                                     subface,
+                                     cell->neighbor_child_on_subface(f, subface),
+                                     face_no_neighbor,
+                                     dealii::numbers::invalid_unsigned_int);
+          eta_squared += integrate_jump();
+        }
+      }
+      else if(cell->neighbor_is_coarser(f))
+      {
+        // the neighbor is coarser: the face of this cell is a subface of the neighbor
+        std::pair<unsigned int, unsigned int> const face_and_subface_no_neighbor =
+          cell->neighbor_of_coarser_neighbor(f);
+        fe_interface_values.reinit(cell,
+                                   f,
+                                   dealii::numbers::invalid_unsigned_int,
+                                   cell->neighbor(f),
+                                   face_and_subface_no_neighbor.first,
+                                   face_and_subface_no_neighbor.second);
+        eta_squared += integrate_jump();
+      }
+      else
+      {
+        fe_interface_values.reinit(cell,
+                                   f,
+                                   dealii::numbers::invalid_unsigned_int,
+                                   cell->neighbor(f),
+                                   cell->neighbor_of_neighbor(f),
+                                   dealii::numbers::invalid_unsigned_int);
+        eta_squared += integrate_jump();
+      }
+    }
+
+    indicators[cell->active_cell_index()] = std::sqrt(eta_squared);
+  }
+}
+
+/*
+ * Computes the refinement indicator for all locally owned cells of the given DoFHandler according
+ * to RefinementIndicator. The solution vector may be distributed in the layout of a MatrixFree
+ * object, the values of the solution on ghost cells are obtained internally.
+ */
+template<int dim, typename Number>
+void
+compute_refinement_indicator(dealii::Vector<float> &                                    indicators,
+                             dealii::DoFHandler<dim> const &                            dof_handler,
+                             dealii::Mapping<dim> const &                               mapping,
+                             dealii::LinearAlgebra::distributed::Vector<Number> const & solution,
+                             RefinementIndicator const & refinement_indicator)
+{
+  // the indicators involve the solution on neighboring cells
+  dealii::IndexSet locally_relevant_dofs;
+  dealii::DoFTools::extract_locally_relevant_dofs(dof_handler, locally_relevant_dofs);
+
+  dealii::LinearAlgebra::distributed::Vector<Number> solution_relevant(
+    dof_handler.locally_owned_dofs(),
+    locally_relevant_dofs,
+    dof_handler.get_triangulation().get_communicator());
+  solution_relevant.copy_locally_owned_data_from(solution);
+  solution_relevant.update_ghost_values();
+
+  if(refinement_indicator == RefinementIndicator::JumpValues)
+  {
+    compute_refinement_indicator_jump_values(indicators, dof_handler, mapping, solution_relevant);
+  }
+  else if(refinement_indicator == RefinementIndicator::Kelly)
+  {
+    std::map<dealii::types::boundary_id, dealii::Function<dim, Number> const *> const neumann_bc;
+
+    indicators.reinit(dof_handler.get_triangulation().n_active_cells());
+    dealii::KellyErrorEstimator<dim>::estimate(mapping,
+                                               dof_handler,
+                                               dealii::QGauss<dim - 1>(
+                                                 dof_handler.get_fe().degree + 1),
+                                               neumann_bc,
+                                               solution_relevant,
+                                               indicators);
+  }
+  else
+  {
+    AssertThrow(false, dealii::ExcMessage("Not implemented."));
+  }
+}
+
+/*
+ * Marks the fractions of cells with the largest and smallest refinement indicators for refinement
+ * and coarsening, respectively, subject to the minimum and maximum refinement level. The
+ * triangulation is not changed by this function, see execute_coarsening_and_refinement().
+ */
+template<int dim>
+void
+mark_cells_for_coarsening_and_refinement(dealii::Triangulation<dim> &       triangulation,
+                                         dealii::Vector<float> const &      indicators,
+                                         AdaptiveMeshRefinementData const & data)
+{
+  if(auto * triangulation_distributed =
+       dynamic_cast<dealii::parallel::distributed::Triangulation<dim> *>(&triangulation))
+  {
+    dealii::parallel::distributed::GridRefinement::refine_and_coarsen_fixed_number(
+      *triangulation_distributed, indicators, data.refine_fraction, data.coarsen_fraction);
+  }
+  else
+  {
+    dealii::GridRefinement::refine_and_coarsen_fixed_number(triangulation,
+                                                            indicators,
+                                                            data.refine_fraction,
+                                                            data.coarsen_fraction);
+  }
+
+  for(auto const & cell : triangulation.active_cell_iterators())
+  {
+    if(not cell->is_locally_owned())
+      continue;
+
+    if(cell->level() >= static_cast<int>(data.maximum_refinement_level))
+      cell->clear_refine_flag();
+
+    if(cell->level() <= static_cast<int>(data.minimum_refinement_level))
+      cell->clear_coarsen_flag();
+  }
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_GRID_ADAPTIVE_MESH_REFINEMENT_H_ */
@@ -0,0 +1,104 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_GRID_ADAPTIVE_MESH_REFINEMENT_DATA_H_
+#define INCLUDE_EXADG_GRID_ADAPTIVE_MESH_REFINEMENT_DATA_H_
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/exceptions.h>
+
+// ExaDG
+#include <exadg/grid/enum_types.h>
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+/*
+ * Parameters of the dynamic adaptive mesh refinement performed during the time loop, see
+ * adaptive_mesh_refinement.h.
+ */
+struct AdaptiveMeshRefinementData
+{
+  AdaptiveMeshRefinementData()
+    : trigger_every_n_time_steps(10),
+      refinement_indicator(RefinementIndicator::JumpValues),
+      refine_fraction(0.3),
+      coarsen_fraction(0.3),
+      maximum_refinement_level(10),
+      minimum_refinement_level(0)
+  {
+  }
+
+  void
+  check() const
+  {
+    AssertThrow(trigger_every_n_time_steps > 0,
+                dealii::ExcMessage("trigger_every_n_time_steps has to be larger than zero."));
+
+    AssertThrow(refine_fraction >= 0.0 and coarsen_fraction >= 0.0 and
+                  refine_fraction + coarsen_fraction <= 1.0,
+                dealii::ExcMessage("The fractions of cells to be refined and coarsened need to "
+                                   "be non-negative and must not sum up to more than one."));
+
+    AssertThrow(minimum_refinement_level <= maximum_refinement_level,
+                dealii::ExcMessage("minimum_refinement_level must not exceed "
+                                   "maximum_refinement_level."));
+  }
+
+  void
+  print(dealii::ConditionalOStream const & pcout) const
+  {
+    print_parameter(pcout, "Trigger every n time steps", trigger_every_n_time_steps);
+    print_parameter(pcout, "Refinement indicator", refinement_indicator);
+    print_parameter(pcout, "Fraction of cells to be refined", refine_fraction);
+    print_parameter(pcout, "Fraction of cells to be coarsened", coarsen_fraction);
+    print_parameter(pcout, "Maximum refinement level", maximum_refinement_level);
+    print_parameter(pcout, "Minimum refinement level", minimum_refinement_level);
+  }
+
+  /*
+   * Returns true if the triangulation is to be adapted after the given number of time steps.
+   */
+  bool
+  do_coarsening_and_refinement(unsigned int const n_time_steps_performed) const
+  {
+    return n_time_steps_performed > 0 and n_time_steps_performed % trigger_every_n_time_steps == 0;
+  }
+
+  // the triangulation is adapted every n-th time step
+  unsigned int trigger_every_n_time_steps;
+
+  RefinementIndicator refinement_indicator;
+
+  // fractions of cells (sorted according to the refinement indicator) that are refined and
+  // coarsened, respectively
+  double refine_fraction;
+  double coarsen_fraction;
+
+  // cells are neither refined beyond the maximum level nor coarsened below the minimum level
+  unsigned int maximum_refinement_level;
+  unsigned int minimum_refinement_level;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_GRID_ADAPTIVE_MESH_REFINEMENT_DATA_H_ */
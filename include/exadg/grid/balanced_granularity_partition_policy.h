@@ -30,15 +30,19 @@ namespace ExaDG
 /**
  * A class to use for the deal.II coarsening functionality, where we try to
  * balance the mesh coarsening with a minimum granularity and the number of
- * partitions on coarser levels.
+ * partitions on coarser levels. Optionally, the coarsest level (the
+ * triangulation without refinement) is agglomerated onto at most
+ * n_mpi_processes_coarsest_level processes.
  */
 template<int dim, int spacedim = dim>
 class BalancedGranularityPartitionPolicy
   : public dealii::RepartitioningPolicyTools::Base<dim, spacedim>
 {
 public:
-  BalancedGranularityPartitionPolicy(unsigned int const n_mpi_processes)
-    : n_mpi_processes_per_level{n_mpi_processes}
+  BalancedGranularityPartitionPolicy(unsigned int const n_mpi_processes,
+                                     unsigned int const n_mpi_processes_coarsest_level = 0)
+    : n_mpi_processes_per_level{n_mpi_processes},
+      n_mpi_processes_coarsest_level(n_mpi_processes_coarsest_level)
   {
   }
 
@@ -55,9 +59,17 @@ public:
     // not immediately go to 200 cells per rank, but limit the growth by a
     // factor of 8, which limits makes sure that we do not create too many
     // messages for individual MPI processes.
-    unsigned int const grain_size_limit =
+    unsigned int grain_size_limit =
       std::min<unsigned int>(200, 8 * n_cells / n_mpi_processes_per_level.back() + 1);
 
+    // agglomerate the coarsest level onto a reduced number of processes
+    if(n_mpi_processes_coarsest_level > 0 and tria_coarse_in.n_global_levels() == 1)
+    {
+      grain_size_limit = std::max<unsigned int>(
+        grain_size_limit,
+        (n_cells + n_mpi_processes_coarsest_level - 1) / n_mpi_processes_coarsest_level);
+    }
+
     dealii::RepartitioningPolicyTools::MinimalGranularityPolicy<dim, spacedim> partitioning_policy(
       grain_size_limit);
     dealii::LinearAlgebra::distributed::Vector<double> const partitions =
@@ -71,6 +83,8 @@ public:
 
 private:
   mutable std::vector<unsigned int> n_mpi_processes_per_level;
+
+  unsigned int const n_mpi_processes_coarsest_level;
 };
 } // namespace ExaDG
 
@@ -62,11 +62,34 @@ enum class ElementType
 
 /*
  * Partitioning type (relevant for fully-distributed triangulation)
+ *
+ * MetisNodeAware: hierarchical partitioning with Metis, where the triangulation is first split
+ *                 into one partition per compute node and each of these partitions is then split
+ *                 among the MPI processes of the node
+ *
+ * ParallelZOrder: the coarse triangulation is created on all MPI processes and refined in
+ *                 parallel by a dealii::parallel::distributed::Triangulation, which partitions
+ *                 the cells along a z-order curve. No MPI process creates the fine triangulation
+ *                 in serial.
  */
 enum class PartitioningType
 {
   Metis,
-  z_order
+  MetisNodeAware,
+  z_order,
+  ParallelZOrder
+};
+
+/*
+ * Refinement indicator used to mark cells for adaptive mesh refinement
+ *
+ * JumpValues: jumps of the DG solution across interior faces
+ * Kelly:      jumps of the normal gradient across interior faces (Kelly error estimator)
+ */
+enum class RefinementIndicator
+{
+  JumpValues,
+  Kelly
 };
 
 /*
@@ -76,6 +76,17 @@ Grid<dim>::initialize(GridData const & data, MPI_Comm const & mpi_comm)
     AssertThrow(false, dealii::ExcMessage("Invalid parameter triangulation_type."));
   }
 
+  // shared-memory communicator
+  if(data.use_shared_memory_communicator)
+  {
+    int const ierr = MPI_Comm_split_type(mpi_comm,
+                                         MPI_COMM_TYPE_SHARED,
+                                         dealii::Utilities::MPI::this_mpi_process(mpi_comm),
+                                         MPI_INFO_NULL,
+                                         &communicator_sm);
+    AssertThrowMPI(ierr);
+  }
+
   // mapping
   if(data.element_type == ElementType::Hypercube)
   {
@@ -92,6 +103,13 @@ Grid<dim>::initialize(GridData const & data, MPI_Comm const & mpi_comm)
   }
 }
 
+template<int dim>
+Grid<dim>::~Grid()
+{
+  if(communicator_sm != MPI_COMM_SELF)
+    MPI_Comm_free(&communicator_sm);
+}
+
 template class Grid<2>;
 template class Grid<3>;
 
@@ -22,6 +22,9 @@
 #ifndef INCLUDE_EXADG_GRID_GRID_H_
 #define INCLUDE_EXADG_GRID_GRID_H_
 
+// C/C++
+#include <functional>
+
 // deal.II
 #include <deal.II/distributed/fully_distributed_tria.h>
 #include <deal.II/distributed/tria.h>
@@ -44,13 +47,26 @@ public:
     dealii::GridTools::PeriodicFacePair<typename dealii::Triangulation<dim>::cell_iterator>>
     PeriodicFacePairs;
 
+  typedef std::function<unsigned int(typename dealii::Triangulation<dim>::cell_iterator const &)>
+    CellWeightFunction;
+
   /**
    * Constructor.
    */
-  Grid()
+  Grid() : communicator_sm(MPI_COMM_SELF)
   {
   }
 
+  /**
+   * Destructor.
+   */
+  ~Grid();
+
+  Grid(Grid const &) = delete;
+
+  Grid &
+  operator=(Grid const &) = delete;
+
   /**
    * Initialize function
    */
@@ -82,6 +98,20 @@ public:
    * global coarsening multigrid.
    */
   std::vector<PeriodicFacePairs> coarse_periodic_face_pairs;
+
+  /**
+   * Communicator comprising the MPI processes on the same compute node, used for the shared-memory
+   * ghost exchange of dealii::MatrixFree, see GridData::use_shared_memory_communicator. Equals
+   * MPI_COMM_SELF if the shared-memory ghost exchange is not used.
+   */
+  MPI_Comm communicator_sm;
+
+  /**
+   * Optional cost of a cell in addition to the modeled cost of LoadBalancingData, e.g., for cells
+   * evaluating a turbulence model or cells at a fluid-structure interface. The weight is used for
+   * cost-weighted repartitioning of the triangulation, see load_balancing.h.
+   */
+  CellWeightFunction additional_cell_weight;
 };
 
 } // namespace ExaDG
@@ -34,16 +34,39 @@ struct GridData
     : triangulation_type(TriangulationType::Distributed),
       element_type(ElementType::Hypercube),
       partitioning_type(PartitioningType::Metis),
+      n_mpi_processes_per_group(1),
       multigrid(MultigridVariant::LocalSmoothing),
       n_refine_global(0),
       mapping_degree(1),
-      file_name()
+      n_mpi_processes_coarse_grid(0),
+      use_shared_memory_communicator(false),
+      file_name(),
+      setup_cache_directory()
   {
   }
 
   void
   check() const
   {
+    if(n_mpi_processes_coarse_grid > 0)
+    {
+      AssertThrow(multigrid == MultigridVariant::GlobalCoarsening and
+                    triangulation_type == TriangulationType::Distributed,
+                  dealii::ExcMessage("Agglomeration of the coarse grid onto a reduced number of "
+                                     "MPI processes requires global coarsening multigrid and "
+                                     "TriangulationType::Distributed."));
+    }
+
+    if(triangulation_type == TriangulationType::FullyDistributed and
+       partitioning_type == PartitioningType::ParallelZOrder)
+    {
+      AssertThrow(element_type == ElementType::Hypercube,
+                  dealii::ExcMessage("PartitioningType::ParallelZOrder is only implemented for "
+                                     "ElementType::Hypercube."));
+    }
+
+    AssertThrow(n_mpi_processes_per_group > 0,
+                dealii::ExcMessage("Parameter n_mpi_processes_per_group has to be positive."));
   }
 
   void
@@ -54,13 +77,26 @@ struct GridData
     print_parameter(pcout, "Element type", element_type);
 
     if(triangulation_type == TriangulationType::FullyDistributed)
+    {
       print_parameter(pcout, "Partitioning type (fully-distributed)", partitioning_type);
 
+      if(partitioning_type != PartitioningType::ParallelZOrder)
+        print_parameter(pcout, "MPI processes per group", n_mpi_processes_per_group);
+    }
+
     print_parameter(pcout, "Multigrid variant", multigrid);
 
+    if(multigrid == MultigridVariant::GlobalCoarsening and n_mpi_processes_coarse_grid > 0)
+      print_parameter(pcout, "MPI processes coarse grid", n_mpi_processes_coarse_grid);
+
     print_parameter(pcout, "Global refinements", n_refine_global);
 
     print_parameter(pcout, "Mapping degree", mapping_degree);
+
+    print_parameter(pcout, "Shared-memory communicator", use_shared_memory_communicator);
+
+    if(not setup_cache_directory.empty())
+      print_parameter(pcout, "Setup cache directory", setup_cache_directory);
   }
 
   TriangulationType triangulation_type;
@@ -70,16 +106,45 @@ struct GridData
   // only relevant for TriangulationType::FullyDistributed
   PartitioningType partitioning_type;
 
+  // Number of MPI processes sharing one serial triangulation during the creation of a
+  // fully-distributed triangulation: only one MPI process per group creates and partitions the
+  // serial triangulation and sends the locally relevant parts to the other processes of the group.
+  // Larger groups reduce the memory consumption and the work during setup. Only relevant for
+  // TriangulationType::FullyDistributed and partitioning types other than ParallelZOrder.
+  unsigned int n_mpi_processes_per_group;
+
   MultigridVariant multigrid;
 
   unsigned int n_refine_global;
 
   unsigned int mapping_degree;
 
+  // Maximum number of MPI processes the coarsest triangulation of global coarsening multigrid is
+  // distributed to. On large numbers of processes, the coarsest level contains only a few cells
+  // per process so that the coarse-grid solve is dominated by communication latency. The remaining
+  // processes do not own cells on the coarsest level. A value of 0 means no restriction.
+  // Only relevant for MultigridVariant::GlobalCoarsening and TriangulationType::Distributed.
+  unsigned int n_mpi_processes_coarse_grid;
+
+  // Create the dealii::MatrixFree objects of the PDE operators, and thereby all vectors
+  // initialized by these objects, with a shared-memory communicator comprising the MPI processes of
+  // a compute node. Ghost values owned by processes of the same node are then read directly from
+  // shared memory instead of being exchanged via MPI messages.
+  bool use_shared_memory_communicator;
+
   // path to a grid file
   // the filename needs to include a proper filename ending/extension so that we can internally
   // deduce the correct type of the file format
   std::string file_name;
+
+  // Directory of an on-disk cache for the triangulation and its partitioning. If not empty, the
+  // triangulation created for a given set of parameters (file name, triangulation type,
+  // partitioning, refinements, number of MPI processes) is stored in this directory and reused by
+  // subsequent runs with the same parameters instead of being created and partitioned again.
+  // Only relevant for TriangulationType::Distributed and TriangulationType::FullyDistributed.
+  // Note that the cache does not detect changes of the grid generation in the application code, in
+  // which case the directory has to be cleared.
+  std::string setup_cache_directory;
 };
 
 } // namespace ExaDG
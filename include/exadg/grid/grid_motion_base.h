@@ -42,8 +42,9 @@ public:
    */
   GridMotionBase(std::shared_ptr<dealii::Mapping<dim> const> mapping_undeformed,
                  unsigned int const                          mapping_degree_q_cache,
-                 dealii::Triangulation<dim> const &          triangulation)
-    : mapping_undeformed(mapping_undeformed)
+                 dealii::Triangulation<dim> const &          triangulation,
+                 double const                                displacement_tolerance = 0.0)
+    : mapping_undeformed(mapping_undeformed), displacement_tolerance(displacement_tolerance)
   {
     // Make sure that dealii::MappingQCache is initialized correctly. An empty dof-vector is used
     // and, hence, no displacements are added to the reference configuration described by
@@ -70,11 +71,56 @@ public:
   }
 
 protected:
+  /**
+   * Initializes the moving mapping according to the given displacement vector. The update is
+   * skipped if no displacement has changed by more than displacement_tolerance (maximum norm)
+   * compared to the displacement vector the moving mapping has last been initialized with, i.e.,
+   * the mesh stays at its last position until the accumulated displacement exceeds the tolerance.
+   * Returns whether the moving mapping has been initialized.
+   */
+  bool
+  update_moving_mapping(VectorType const &              displacement,
+                        dealii::DoFHandler<dim> const & dof_handler)
+  {
+    if(displacement_tolerance > 0.0 and displacement_mapping.size() == displacement.size())
+    {
+      Number max_change = 0.0;
+      for(unsigned int i = 0; i < displacement.locally_owned_size(); ++i)
+        max_change = std::max(max_change,
+                              std::abs(displacement.local_element(i) -
+                                       displacement_mapping.local_element(i)));
+
+      max_change = dealii::Utilities::MPI::max(max_change, dof_handler.get_communicator());
+
+      if(max_change <= displacement_tolerance)
+        return false;
+    }
+
+    moving_mapping->initialize_mapping_q_cache(mapping_undeformed, displacement, dof_handler);
+
+    if(displacement_tolerance > 0.0)
+    {
+      if(displacement_mapping.size() != displacement.size())
+        displacement_mapping.reinit(displacement, true);
+      displacement_mapping.copy_locally_owned_data_from(displacement);
+    }
+
+    return true;
+  }
+
   // mapping describing undeformed reference state
   std::shared_ptr<dealii::Mapping<dim> const> mapping_undeformed;
 
   // time-dependent mapping describing deformed state
   std::shared_ptr<MappingDoFVector<dim, Number>> moving_mapping;
+
+private:
+  // the moving mapping is only updated if the displacement has changed by more than this
+  // (absolute) tolerance, see update_moving_mapping()
+  double const displacement_tolerance;
+
+  // displacement vector the moving mapping has last been initialized with
+  VectorType displacement_mapping;
 };
 
 } // namespace ExaDG
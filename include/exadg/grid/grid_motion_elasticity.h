@@ -46,11 +46,13 @@ public:
    */
   GridMotionElasticity(std::shared_ptr<dealii::Mapping<dim> const>       mapping_undeformed,
                        std::shared_ptr<Structure::Operator<dim, Number>> structure_operator,
-                       Structure::Parameters const &                     structure_parameters)
+                       Structure::Parameters const &                     structure_parameters,
+                       double const                                      displacement_tolerance)
     : GridMotionBase<dim, Number>(mapping_undeformed,
                                   // extract mapping_degree_moving from elasticity operator
                                   structure_operator->get_dof_handler().get_fe().degree,
-                                  structure_operator->get_dof_handler().get_triangulation()),
+                                  structure_operator->get_dof_handler().get_triangulation(),
+                                  displacement_tolerance),
       pde_operator(structure_operator),
       param(structure_parameters),
       pcout(std::cout,
@@ -64,7 +66,7 @@ public:
   /**
    * Updates the mapping, i.e., moves the grid by solving a pseudo-solid problem.
    */
-  void
+  bool
   update(double const time, bool const print_solver_info) override
   {
     dealii::Timer timer;
@@ -106,9 +108,7 @@ public:
       }
     }
 
-    this->moving_mapping->initialize_mapping_q_cache(this->mapping_undeformed,
-                                                     displacement,
-                                                     pde_operator->get_dof_handler());
+    return this->update_moving_mapping(displacement, pde_operator->get_dof_handler());
   }
 
   /**
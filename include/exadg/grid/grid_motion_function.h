@@ -54,7 +54,7 @@ public:
   /**
    * Updates the grid coordinates using a dealii::Function<dim> object evaluated at a given time.
    */
-  void
+  bool
   update(double const time, bool const print_solver_info) override
   {
     (void)print_solver_info;
@@ -62,6 +62,8 @@ public:
     mesh_movement_function->set_time(time);
 
     this->initialize(triangulation, mesh_movement_function);
+
+    return true;
   }
 
 private:
@@ -46,9 +46,10 @@ public:
   }
 
   /**
-   * Updates the mapping, i.e., moves the grid.
+   * Updates the mapping, i.e., moves the grid. Returns false if the mapping has been left
+   * unchanged, so that data structures depending on the geometry do not have to be updated.
    */
-  virtual void
+  virtual bool
   update(double const time, bool const print_solver_info) = 0;
 
   /**
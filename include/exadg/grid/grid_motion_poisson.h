@@ -45,11 +45,13 @@ public:
    * Constructor.
    */
   GridMotionPoisson(std::shared_ptr<dealii::Mapping<dim> const>          mapping_undeformed,
-                    std::shared_ptr<Poisson::Operator<dim, dim, Number>> poisson_operator)
+                    std::shared_ptr<Poisson::Operator<dim, dim, Number>> poisson_operator,
+                    double const                                         displacement_tolerance)
     : GridMotionBase<dim, Number>(mapping_undeformed,
                                   // extract mapping_degree_moving from Poisson operator
                                   poisson_operator->get_dof_handler().get_fe().degree,
-                                  poisson_operator->get_dof_handler().get_triangulation()),
+                                  poisson_operator->get_dof_handler().get_triangulation(),
+                                  displacement_tolerance),
       poisson(poisson_operator),
       pcout(std::cout,
             dealii::Utilities::MPI::this_mpi_process(
@@ -62,7 +64,7 @@ public:
   /**
    * Updates the mapping, i.e., moves the mesh by solving a Poisson-type problem.
    */
-  void
+  bool
   update(double const time, bool const print_solver_info) override
   {
     dealii::Timer timer;
@@ -84,9 +86,7 @@ public:
       print_solver_info_linear(pcout, n_iter, timer.wall_time());
     }
 
-    this->moving_mapping->initialize_mapping_q_cache(this->mapping_undeformed,
-                                                     displacement,
-                                                     poisson->get_dof_handler());
+    return this->update_moving_mapping(displacement, poisson->get_dof_handler());
   }
 
   /**
@@ -22,14 +22,25 @@
 #ifndef INCLUDE_EXADG_GRID_GRID_UTILITIES_H_
 #define INCLUDE_EXADG_GRID_GRID_UTILITIES_H_
 
+// C/C++
+#include <algorithm>
+#include <map>
+#include <queue>
+#include <set>
+
 // deal.II
 #include <deal.II/grid/grid_in.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/sparsity_pattern.h>
+#include <deal.II/lac/sparsity_tools.h>
 #include <deal.II/multigrid/mg_transfer_global_coarsening.h>
 
 // ExaDG
 #include <exadg/grid/balanced_granularity_partition_policy.h>
 #include <exadg/grid/grid.h>
 #include <exadg/grid/perform_local_refinements.h>
+#include <exadg/grid/triangulation_cache.h>
 
 namespace ExaDG
 {
@@ -133,6 +144,123 @@ transform_periodic_face_pairs_to_dof_cell_iterator(
   return periodic_faces_dof;
 }
 
+/**
+ * Returns for each MPI process of the communicator the index of the compute node it is running on,
+ * where the compute nodes are numbered contiguously starting from zero in the order of their first
+ * MPI process. This function has to be called by all MPI processes of the communicator.
+ */
+inline std::vector<unsigned int>
+get_node_indices_of_mpi_processes(MPI_Comm const & mpi_comm)
+{
+  unsigned int const rank = dealii::Utilities::MPI::this_mpi_process(mpi_comm);
+
+  MPI_Comm  communicator_sm;
+  int const ierr =
+    MPI_Comm_split_type(mpi_comm, MPI_COMM_TYPE_SHARED, rank, MPI_INFO_NULL, &communicator_sm);
+  AssertThrowMPI(ierr);
+
+  // a compute node is identified by the smallest rank running on it
+  unsigned int const first_rank_on_node = dealii::Utilities::MPI::min(rank, communicator_sm);
+
+  MPI_Comm_free(&communicator_sm);
+
+  std::vector<unsigned int> const first_ranks =
+    dealii::Utilities::MPI::all_gather(mpi_comm, first_rank_on_node);
+
+  std::map<unsigned int, unsigned int> node_index_of_first_rank;
+
+  std::vector<unsigned int> node_indices(first_ranks.size());
+  for(unsigned int r = 0; r < first_ranks.size(); ++r)
+  {
+    auto const it =
+      node_index_of_first_rank.emplace(first_ranks[r], node_index_of_first_rank.size()).first;
+    node_indices[r] = it->second;
+  }
+
+  return node_indices;
+}
+
+/**
+ * Node-aware partitioning of a serial triangulation with Metis: The cells are split into one
+ * partition per MPI process, and the partitions are then mapped onto the compute nodes such that
+ * neighboring partitions tend to be assigned to the same compute node. Each compute node receives
+ * as many partitions as MPI processes are running on it, so that the load is balanced also if the
+ * number of MPI processes differs between compute nodes. Compared to a flat partitioning, more
+ * ghost cells are owned by MPI processes of the same compute node, which is beneficial for the
+ * shared-memory ghost exchange, see GridData::use_shared_memory_communicator.
+ */
+template<int dim>
+void
+partition_triangulation_node_aware(dealii::Triangulation<dim> &      tria,
+                                   std::vector<unsigned int> const & node_indices)
+{
+  unsigned int const n_ranks = node_indices.size();
+  unsigned int const n_nodes = *std::max_element(node_indices.begin(), node_indices.end()) + 1;
+
+  dealii::DynamicSparsityPattern cell_connectivity;
+  dealii::GridTools::get_face_connectivity_of_cells(tria, cell_connectivity);
+
+  dealii::SparsityPattern connectivity;
+  connectivity.copy_from(cell_connectivity);
+
+  // one partition per MPI process
+  std::vector<unsigned int> part_of_cell(tria.n_active_cells(), 0);
+  if(n_ranks > 1)
+    dealii::SparsityTools::partition(connectivity, n_ranks, part_of_cell);
+
+  // neighbors of the partitions
+  std::vector<std::set<unsigned int>> neighbor_parts(n_ranks);
+  for(unsigned int c = 0; c < part_of_cell.size(); ++c)
+  {
+    for(auto it = connectivity.begin(c); it != connectivity.end(c); ++it)
+    {
+      if(part_of_cell[it->column()] != part_of_cell[c])
+        neighbor_parts[part_of_cell[c]].insert(part_of_cell[it->column()]);
+    }
+  }
+
+  // Traverse the partitions in breadth-first order, so that consecutive partitions are mostly
+  // neighbors, and assign them to the MPI processes ordered by compute node.
+  std::vector<unsigned int> ranks_ordered_by_node;
+  for(unsigned int node = 0; node < n_nodes; ++node)
+    for(unsigned int r = 0; r < n_ranks; ++r)
+      if(node_indices[r] == node)
+        ranks_ordered_by_node.push_back(r);
+
+  std::vector<unsigned int> rank_of_part(n_ranks, dealii::numbers::invalid_unsigned_int);
+  std::vector<bool>         visited(n_ranks, false);
+  unsigned int              n_assigned = 0;
+  for(unsigned int start = 0; start < n_ranks; ++start)
+  {
+    if(visited[start])
+      continue;
+
+    std::queue<unsigned int> queue;
+    queue.push(start);
+    visited[start] = true;
+
+    while(not(queue.empty()))
+    {
+      unsigned int const part = queue.front();
+      queue.pop();
+
+      rank_of_part[part] = ranks_ordered_by_node[n_assigned++];
+
+      for(auto const neighbor : neighbor_parts[part])
+      {
+        if(not(visited[neighbor]))
+        {
+          visited[neighbor] = true;
+          queue.push(neighbor);
+        }
+      }
+    }
+  }
+
+  for(auto const & cell : tria.active_cell_iterators())
+    cell->set_subdomain_id(rank_of_part[part_of_cell[cell->active_cell_index()]]);
+}
+
 /**
  * This function creates a triangulation based on a lambda function and refinement parameters for
  * global and local mesh refinements. This function is used to create the fine triangulation on the
@@ -163,16 +291,118 @@ create_triangulation(
         "Currently, dealii triangulations composed of simplicial elements do not allow local refinements."));
   }
 
+  // The name of the setup cache entry depends on the coarse grid created by the application,
+  // which is therefore created in a serial triangulation to compute its checksum.
+  auto const get_cache_file_name = [&]() {
+    dealii::Triangulation<dim> coarse_triangulation;
+    PeriodicFacePairs<dim>     coarse_periodic_face_pairs;
+    lambda_create_triangulation(coarse_triangulation,
+                                coarse_periodic_face_pairs,
+                                0,
+                                std::vector<unsigned int>());
+
+    return get_triangulation_cache_file_name<dim>(data,
+                                                  compute_coarse_grid_checksum(
+                                                    coarse_triangulation),
+                                                  global_refinements,
+                                                  vector_local_refinements,
+                                                  triangulation.get_communicator());
+  };
+
   if(data.triangulation_type == TriangulationType::Serial or
-     data.triangulation_type == TriangulationType::Distributed)
+     (data.triangulation_type == TriangulationType::Distributed and
+      data.setup_cache_directory.empty()))
   {
     lambda_create_triangulation(triangulation,
                                 periodic_face_pairs,
                                 global_refinements,
                                 vector_local_refinements);
   }
+  else if(data.triangulation_type == TriangulationType::Distributed)
+  {
+    auto tria_distributed =
+      dynamic_cast<dealii::parallel::distributed::Triangulation<dim> *>(&triangulation);
+    AssertThrow(tria_distributed != nullptr,
+                dealii::ExcMessage("Expected dealii::parallel::distributed::Triangulation."));
+
+    std::string const file_name = get_cache_file_name();
+
+    if(cache_file_exists(file_name + ".info", triangulation.get_communicator()))
+    {
+      // create the coarse triangulation (including manifolds and periodicity), the refinements
+      // and the partitioning are restored from the setup cache
+      lambda_create_triangulation(triangulation,
+                                  periodic_face_pairs,
+                                  0,
+                                  std::vector<unsigned int>());
+
+      tria_distributed->load(file_name);
+    }
+    else
+    {
+      lambda_create_triangulation(triangulation,
+                                  periodic_face_pairs,
+                                  global_refinements,
+                                  vector_local_refinements);
+
+      create_directories(data.setup_cache_directory, triangulation.get_communicator());
+
+      // save under a temporary name and rename afterwards
+      std::string const temporary_file_name =
+        file_name + get_temporary_file_suffix(triangulation.get_communicator());
+      tria_distributed->save(temporary_file_name);
+      rename_saved_files(temporary_file_name, file_name, triangulation.get_communicator());
+    }
+  }
+  else if(data.triangulation_type == TriangulationType::FullyDistributed and
+          data.partitioning_type == PartitioningType::ParallelZOrder)
+  {
+    // The coarse triangulation is created on all MPI processes and refined in parallel, i.e., each
+    // MPI process only stores its locally owned part of the fine triangulation (plus ghost cells).
+    auto const create_description = [&]() {
+      bool const construct_multigrid_hierarchy =
+        data.multigrid == MultigridVariant::LocalSmoothing;
+
+      typename dealii::parallel::distributed::Triangulation<dim>::Settings distributed_settings =
+        dealii::parallel::distributed::Triangulation<dim>::default_setting;
+      if(construct_multigrid_hierarchy)
+        distributed_settings =
+          dealii::parallel::distributed::Triangulation<dim>::construct_multigrid_hierarchy;
+
+      dealii::parallel::distributed::Triangulation<dim> tria_distributed(
+        triangulation.get_communicator(),
+        GridUtilities::get_mesh_smoothing<dim>(construct_multigrid_hierarchy, data.element_type),
+        distributed_settings);
+
+      lambda_create_triangulation(tria_distributed,
+                                  periodic_face_pairs,
+                                  global_refinements,
+                                  vector_local_refinements);
+
+      return dealii::TriangulationDescription::Utilities::create_description_from_triangulation(
+        tria_distributed,
+        triangulation.get_communicator(),
+        construct_multigrid_hierarchy ?
+          dealii::TriangulationDescription::construct_multigrid_hierarchy :
+          dealii::TriangulationDescription::default_setting);
+    };
+
+    triangulation.create_triangulation(
+      create_description_with_cache<dim>(create_description,
+                                         data,
+                                         data.setup_cache_directory.empty() ?
+                                           std::string() :
+                                           get_cache_file_name(),
+                                         triangulation.get_communicator()));
+  }
   else if(data.triangulation_type == TriangulationType::FullyDistributed)
   {
+    // the mapping of MPI processes to compute nodes has to be determined by all MPI processes,
+    // while the serial partitioner is only called on some of them
+    std::vector<unsigned int> node_indices;
+    if(data.partitioning_type == PartitioningType::MetisNodeAware)
+      node_indices = get_node_indices_of_mpi_processes(triangulation.get_communicator());
+
     auto const serial_grid_generator = [&](dealii::Triangulation<dim, dim> & tria_serial) {
       lambda_create_triangulation(tria_serial,
                                   periodic_face_pairs,
@@ -189,6 +419,11 @@ create_triangulation(
         dealii::GridTools::partition_triangulation(dealii::Utilities::MPI::n_mpi_processes(comm),
                                                    tria_serial);
       }
+      else if(data.partitioning_type == PartitioningType::MetisNodeAware)
+      {
+        AssertDimension(node_indices.size(), dealii::Utilities::MPI::n_mpi_processes(comm));
+        partition_triangulation_node_aware(tria_serial, node_indices);
+      }
       else if(data.partitioning_type == PartitioningType::z_order)
       {
         dealii::GridTools::partition_triangulation_zorder(
@@ -200,7 +435,7 @@ create_triangulation(
       }
     };
 
-    unsigned int const group_size = 1;
+    unsigned int const group_size = data.n_mpi_processes_per_group;
 
     typename dealii::TriangulationDescription::Settings triangulation_description_setting =
       dealii::TriangulationDescription::default_setting;
@@ -229,15 +464,24 @@ create_triangulation(
       GridUtilities::get_mesh_smoothing<dim>(data.multigrid == MultigridVariant::LocalSmoothing,
                                              data.element_type);
 
-    auto const description = dealii::TriangulationDescription::Utilities::
-      create_description_from_triangulation_in_groups<dim, dim>(serial_grid_generator,
-                                                                serial_grid_partitioner,
-                                                                triangulation.get_communicator(),
-                                                                group_size,
-                                                                mesh_smoothing,
-                                                                triangulation_description_setting);
+    auto const create_description = [&]() {
+      return dealii::TriangulationDescription::Utilities::
+        create_description_from_triangulation_in_groups<dim, dim>(
+          serial_grid_generator,
+          serial_grid_partitioner,
+          triangulation.get_communicator(),
+          group_size,
+          mesh_smoothing,
+          triangulation_description_setting);
+    };
 
-    triangulation.create_triangulation(description);
+    triangulation.create_triangulation(
+      create_description_with_cache<dim>(create_description,
+                                         data,
+                                         data.setup_cache_directory.empty() ?
+                                           std::string() :
+                                           get_cache_file_name(),
+                                         triangulation.get_communicator()));
   }
   else
   {
@@ -292,7 +536,8 @@ create_coarse_triangulations(
       dealii::MGTransferGlobalCoarseningTools::create_geometric_coarsening_sequence(
         fine_triangulation,
         BalancedGranularityPartitionPolicy<dim>(
-          dealii::Utilities::MPI::n_mpi_processes(fine_triangulation.get_communicator())));
+          dealii::Utilities::MPI::n_mpi_processes(fine_triangulation.get_communicator()),
+          data.n_mpi_processes_coarse_grid));
 
     coarse_periodic_face_pairs.resize(coarse_triangulations.size());
     for(unsigned int level = 0; level < coarse_periodic_face_pairs.size(); ++level)
@@ -0,0 +1,131 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_GRID_LOAD_BALANCING_H_
+#define INCLUDE_EXADG_GRID_LOAD_BALANCING_H_
+
+// deal.II
+#include <deal.II/base/geometry_info.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/grid/tria.h>
+
+// ExaDG
+#include <exadg/grid/grid.h>
+#include <exadg/grid/load_balancing_data.h>
+
+namespace ExaDG
+{
+/*
+ * Returns the modeled cost of a cell, see LoadBalancingData. Periodic faces are interior faces in
+ * terms of the computational work and do not count as boundary faces.
+ */
+template<int dim>
+unsigned int
+compute_cell_weight(typename dealii::Triangulation<dim>::cell_iterator const & cell,
+                    LoadBalancingData const &                                  data,
+                    typename Grid<dim>::CellWeightFunction const & additional_cell_weight)
+{
+  unsigned int weight = data.weight_cell;
+
+  if(data.weight_boundary_face > 0)
+  {
+    for(unsigned int const f : cell->face_indices())
+      if(cell->at_boundary(f) and not cell->has_periodic_neighbor(f))
+        weight += data.weight_boundary_face;
+  }
+
+  if(additional_cell_weight)
+    weight += additional_cell_weight(cell);
+
+  return weight;
+}
+
+/*
+ * Attaches the cell weights to the triangulation so that every subsequent repartitioning, i.e.,
+ * calls to repartition() or execute_coarsening_and_refinement(), distributes the modeled cost
+ * instead of the number of cells evenly among the MPI processes.
+ */
+template<int dim>
+void
+connect_cell_weight(dealii::Triangulation<dim> &                   triangulation,
+                    LoadBalancingData const &                      data,
+                    typename Grid<dim>::CellWeightFunction const & additional_cell_weight)
+{
+  typedef typename dealii::Triangulation<dim>::cell_iterator CellIterator;
+  typedef typename dealii::Triangulation<dim>::CellStatus    CellStatus;
+
+  auto tria = dynamic_cast<dealii::parallel::distributed::Triangulation<dim> *>(&triangulation);
+
+  AssertThrow(tria != nullptr,
+              dealii::ExcMessage("Cost-weighted repartitioning requires "
+                                 "TriangulationType::Distributed."));
+
+  auto const cell_weight = [data, additional_cell_weight](CellIterator const & cell,
+                                                          CellStatus const     status) {
+    unsigned int weight = compute_cell_weight<dim>(cell, data, additional_cell_weight);
+
+    // a cell marked for refinement is replaced by its children
+    if(status == dealii::Triangulation<dim>::CELL_REFINE)
+      weight *= dealii::GeometryInfo<dim>::max_children_per_cell;
+
+    return weight;
+  };
+
+#if DEAL_II_VERSION_GTE(9, 4, 0)
+  tria->signals.weight.connect(cell_weight);
+#else
+  // deal.II adds a weight of 1000 to every cell
+  tria->signals.cell_weight.connect(
+    [cell_weight](CellIterator const & cell, CellStatus const status) {
+      unsigned int const total_weight = cell_weight(cell, status);
+      return total_weight > 1000 ? total_weight - 1000 : 0;
+    });
+#endif
+}
+
+/*
+ * Returns the load imbalance, i.e., the maximum load over all MPI processes divided by the average
+ * load, where the load of an MPI process is the sum of the modeled cost of its locally owned cells.
+ * A value of one corresponds to a perfect load balance.
+ */
+template<int dim>
+double
+compute_load_imbalance(dealii::Triangulation<dim> const &             triangulation,
+                       LoadBalancingData const &                      data,
+                       typename Grid<dim>::CellWeightFunction const & additional_cell_weight)
+{
+  double load = 0.0;
+  for(auto const & cell : triangulation.active_cell_iterators())
+  {
+    if(cell->is_locally_owned())
+      load += compute_cell_weight<dim>(cell, data, additional_cell_weight);
+  }
+
+  dealii::Utilities::MPI::MinMaxAvg const load_statistics =
+    dealii::Utilities::MPI::min_max_avg(load, triangulation.get_communicator());
+
+  return load_statistics.max / load_statistics.avg;
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_GRID_LOAD_BALANCING_H_ */
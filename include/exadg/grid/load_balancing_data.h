@@ -0,0 +1,97 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_GRID_LOAD_BALANCING_DATA_H_
+#define INCLUDE_EXADG_GRID_LOAD_BALANCING_DATA_H_
+
+// deal.II
+#include <deal.II/base/conditional_ostream.h>
+#include <deal.II/base/exceptions.h>
+
+// ExaDG
+#include <exadg/utilities/print_functions.h>
+
+namespace ExaDG
+{
+/*
+ * Parameters of the cost-weighted repartitioning of the triangulation performed during the time
+ * loop, see load_balancing.h. The cost of a cell is modeled as
+ *
+ *   weight = weight_cell + n_boundary_faces * weight_boundary_face + additional weight,
+ *
+ * where the additional weight is provided by the application, see Grid::additional_cell_weight.
+ */
+struct LoadBalancingData
+{
+  LoadBalancingData()
+    : trigger_every_n_time_steps(100),
+      weight_cell(1000),
+      weight_boundary_face(0),
+      imbalance_tolerance(1.1)
+  {
+  }
+
+  void
+  check() const
+  {
+    AssertThrow(trigger_every_n_time_steps > 0,
+                dealii::ExcMessage("trigger_every_n_time_steps has to be larger than zero."));
+
+    AssertThrow(weight_cell > 0, dealii::ExcMessage("weight_cell has to be larger than zero."));
+
+    AssertThrow(imbalance_tolerance >= 1.0,
+                dealii::ExcMessage("imbalance_tolerance must not be smaller than one."));
+  }
+
+  void
+  print(dealii::ConditionalOStream const & pcout) const
+  {
+    print_parameter(pcout, "Trigger every n time steps", trigger_every_n_time_steps);
+    print_parameter(pcout, "Weight per cell", weight_cell);
+    print_parameter(pcout, "Weight per boundary face", weight_boundary_face);
+    print_parameter(pcout, "Imbalance tolerance", imbalance_tolerance);
+  }
+
+  /*
+   * Returns true if the load balance is to be checked after the given number of time steps.
+   */
+  bool
+  do_repartitioning(unsigned int const n_time_steps_performed) const
+  {
+    return n_time_steps_performed > 0 and n_time_steps_performed % trigger_every_n_time_steps == 0;
+  }
+
+  // the load balance is checked every n-th time step
+  unsigned int trigger_every_n_time_steps;
+
+  // modeled cost of a cell and additional cost of each boundary face of a cell (evaluation of
+  // boundary conditions, boundary integrals of postprocessing, coupling at interfaces)
+  unsigned int weight_cell;
+  unsigned int weight_boundary_face;
+
+  // the triangulation is repartitioned only if the maximum load over all MPI processes exceeds
+  // the average load by this factor
+  double imbalance_tolerance;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_GRID_LOAD_BALANCING_DATA_H_ */
@@ -276,105 +276,272 @@ public:
 namespace MappingTools
 {
 /**
- * Use this function to initialize the mapping for use in multigrid with global refinement
- * transfer type. This function only takes the grid coordinates described by mapping_q_cache without
- * adding displacements in order to initialize mapping_multigrid for all multigrid levels.
+ * Class used to initialize the mapping for all multigrid levels in case of local smoothing
+ * (global refinement transfer type), where the grid coordinates described by mapping_q_cache are
+ * interpolated to all multigrid levels of the triangulation.
+ *
+ * The data structures set up in the constructor (dealii::DoFHandler, transfer operator and
+ * ghosted level vectors) only depend on the triangulation and the mapping degree, but not on the
+ * grid coordinates. Hence, if the mesh moves while its topology remains unchanged, it suffices to
+ * call update() with the moved mapping, which only recomputes the grid coordinates on all levels.
  */
 template<int dim, typename Number>
-void
-initialize_multigrid(std::shared_ptr<MappingDoFVector<dim, Number>>      mapping_multigrid,
-                     std::shared_ptr<dealii::MappingQCache<dim> const> & mapping_q_cache,
-                     dealii::Triangulation<dim> const &                  triangulation)
+class MultigridMappingLocalSmoothing
 {
-  AssertThrow(dealii::MultithreadInfo::n_threads() == 1, dealii::ExcNotImplemented());
-
+private:
   typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
 
-  // we have to project the solution onto all coarse levels of the triangulation
-  dealii::MGLevelObject<VectorType> grid_coordinates_all_levels,
-    grid_coordinates_all_levels_ghosted;
-  unsigned int const n_levels = triangulation.n_global_levels();
-  grid_coordinates_all_levels.resize(0, n_levels - 1);
-  grid_coordinates_all_levels_ghosted.resize(0, n_levels - 1);
-
-  dealii::FESystem<dim>   fe(dealii::FE_Q<dim>(mapping_q_cache->get_degree()), dim);
-  dealii::DoFHandler<dim> dof_handler(triangulation);
-  dof_handler.distribute_dofs(fe);
-  dof_handler.distribute_mg_dofs();
-  VectorType grid_coordinates_fine_level;
-  mapping_multigrid->fill_grid_coordinates_vector(*mapping_q_cache,
-                                                  grid_coordinates_fine_level,
-                                                  dof_handler);
+public:
+  MultigridMappingLocalSmoothing(dealii::Triangulation<dim> const & triangulation,
+                                 unsigned int const                 mapping_degree)
+    : fe(dealii::FE_Q<dim>(mapping_degree), dim), dof_handler(triangulation)
+  {
+    AssertThrow(dealii::MultithreadInfo::n_threads() == 1, dealii::ExcNotImplemented());
 
-  dealii::MGTransferMatrixFree<dim, Number> transfer;
-  transfer.build(dof_handler);
-  transfer.interpolate_to_mg(dof_handler, grid_coordinates_all_levels, grid_coordinates_fine_level);
+    dof_handler.distribute_dofs(fe);
+    dof_handler.distribute_mg_dofs();
 
-  for(unsigned int level = 0; level < n_levels; level++)
-  {
-    dealii::IndexSet relevant_dofs;
-    dealii::DoFTools::extract_locally_relevant_level_dofs(dof_handler, level, relevant_dofs);
+    transfer.build(dof_handler);
 
-    grid_coordinates_all_levels_ghosted[level].reinit(
-      dof_handler.locally_owned_mg_dofs(level),
-      relevant_dofs,
-      grid_coordinates_all_levels[level].get_mpi_communicator());
+    unsigned int const n_levels = triangulation.n_global_levels();
+    grid_coordinates_all_levels.resize(0, n_levels - 1);
+    grid_coordinates_all_levels_ghosted.resize(0, n_levels - 1);
 
-    grid_coordinates_all_levels_ghosted[level].copy_locally_owned_data_from(
-      grid_coordinates_all_levels[level]);
+    for(unsigned int level = 0; level < n_levels; level++)
+    {
+      dealii::IndexSet relevant_dofs;
+      dealii::DoFTools::extract_locally_relevant_level_dofs(dof_handler, level, relevant_dofs);
 
-    grid_coordinates_all_levels_ghosted[level].update_ghost_values();
+      grid_coordinates_all_levels_ghosted[level].reinit(dof_handler.locally_owned_mg_dofs(level),
+                                                        relevant_dofs,
+                                                        dof_handler.get_communicator());
+    }
   }
 
-  AssertThrow(fe.element_multiplicity(0) == dim,
-              dealii::ExcMessage("Expected finite element with dim components."));
+  /**
+   * Initializes mapping_multigrid for all multigrid levels according to the grid coordinates
+   * described by mapping_q_cache (without adding displacements).
+   */
+  void
+  update(MappingDoFVector<dim, Number> &    mapping_multigrid,
+         dealii::MappingQCache<dim> const & mapping_q_cache)
+  {
+    AssertThrow(mapping_q_cache.get_degree() == fe.degree,
+                dealii::ExcMessage("Mapping degree does not match the setup of this object."));
 
-  // update mapping for all multigrid levels according to grid coordinates described by static
-  // mapping
-  mapping_multigrid->initialize(
-    dof_handler.get_triangulation(),
-    [&](const typename dealii::Triangulation<dim>::cell_iterator & cell_tria)
-      -> std::vector<dealii::Point<dim>> {
-      unsigned int const level = cell_tria->level();
+    // we have to project the solution onto all coarse levels of the triangulation
+    mapping_multigrid.fill_grid_coordinates_vector(mapping_q_cache,
+                                                   grid_coordinates_fine_level,
+                                                   dof_handler);
 
-      typename dealii::DoFHandler<dim>::cell_iterator cell(&cell_tria->get_triangulation(),
-                                                           level,
-                                                           cell_tria->index(),
-                                                           &dof_handler);
+    transfer.interpolate_to_mg(dof_handler,
+                               grid_coordinates_all_levels,
+                               grid_coordinates_fine_level);
 
-      unsigned int const scalar_dofs_per_cell = dealii::Utilities::pow(fe.degree + 1, dim);
+    for(unsigned int level = 0; level < grid_coordinates_all_levels.n_levels(); level++)
+    {
+      grid_coordinates_all_levels_ghosted[level].copy_locally_owned_data_from(
+        grid_coordinates_all_levels[level]);
 
-      std::vector<dealii::Point<dim>> grid_coordinates(scalar_dofs_per_cell);
+      grid_coordinates_all_levels_ghosted[level].update_ghost_values();
+    }
 
-      if(cell->level_subdomain_id() != dealii::numbers::artificial_subdomain_id)
-      {
-        std::vector<dealii::types::global_dof_index> dof_indices(fe.dofs_per_cell);
-        cell->get_mg_dof_indices(dof_indices);
+    AssertThrow(fe.element_multiplicity(0) == dim,
+                dealii::ExcMessage("Expected finite element with dim components."));
+
+    // update mapping for all multigrid levels according to grid coordinates described by static
+    // mapping
+    mapping_multigrid.initialize(
+      dof_handler.get_triangulation(),
+      [&](const typename dealii::Triangulation<dim>::cell_iterator & cell_tria)
+        -> std::vector<dealii::Point<dim>> {
+        unsigned int const level = cell_tria->level();
+
+        typename dealii::DoFHandler<dim>::cell_iterator cell(&cell_tria->get_triangulation(),
+                                                             level,
+                                                             cell_tria->index(),
+                                                             &dof_handler);
 
-        for(unsigned int i = 0; i < dof_indices.size(); ++i)
+        unsigned int const scalar_dofs_per_cell = dealii::Utilities::pow(fe.degree + 1, dim);
+
+        std::vector<dealii::Point<dim>> grid_coordinates(scalar_dofs_per_cell);
+
+        if(cell->level_subdomain_id() != dealii::numbers::artificial_subdomain_id)
         {
-          std::pair<unsigned int, unsigned int> const id = fe.system_to_component_index(i);
+          std::vector<dealii::types::global_dof_index> dof_indices(fe.dofs_per_cell);
+          cell->get_mg_dof_indices(dof_indices);
 
-          if(fe.dofs_per_vertex > 0) // dealii::FE_Q
-          {
-            grid_coordinates[id.second][id.first] =
-              grid_coordinates_all_levels_ghosted[level](dof_indices[i]);
-          }
-          else // dealii::FE_DGQ
+          for(unsigned int i = 0; i < dof_indices.size(); ++i)
           {
-            grid_coordinates[mapping_multigrid->lexicographic_to_hierarchic_numbering[id.second]]
-                            [id.first] = grid_coordinates_all_levels_ghosted[level](dof_indices[i]);
+            std::pair<unsigned int, unsigned int> const id = fe.system_to_component_index(i);
+
+            if(fe.dofs_per_vertex > 0) // dealii::FE_Q
+            {
+              grid_coordinates[id.second][id.first] =
+                grid_coordinates_all_levels_ghosted[level](dof_indices[i]);
+            }
+            else // dealii::FE_DGQ
+            {
+              grid_coordinates[mapping_multigrid.lexicographic_to_hierarchic_numbering[id.second]]
+                              [id.first] =
+                                grid_coordinates_all_levels_ghosted[level](dof_indices[i]);
+            }
           }
         }
-      }
 
-      return grid_coordinates;
-    });
+        return grid_coordinates;
+      });
+  }
+
+private:
+  dealii::FESystem<dim>   fe;
+  dealii::DoFHandler<dim> dof_handler;
+
+  dealii::MGTransferMatrixFree<dim, Number> transfer;
+
+  VectorType                        grid_coordinates_fine_level;
+  dealii::MGLevelObject<VectorType> grid_coordinates_all_levels;
+  dealii::MGLevelObject<VectorType> grid_coordinates_all_levels_ghosted;
+};
+
+/**
+ * Use this function to initialize the mapping for use in multigrid with global refinement
+ * transfer type. This function only takes the grid coordinates described by mapping_q_cache without
+ * adding displacements in order to initialize mapping_multigrid for all multigrid levels. Use
+ * MultigridMappingLocalSmoothing directly to reuse the setup for repeated calls.
+ */
+template<int dim, typename Number>
+void
+initialize_multigrid(std::shared_ptr<MappingDoFVector<dim, Number>>      mapping_multigrid,
+                     std::shared_ptr<dealii::MappingQCache<dim> const> & mapping_q_cache,
+                     dealii::Triangulation<dim> const &                  triangulation)
+{
+  MultigridMappingLocalSmoothing<dim, Number> multigrid_mapping(triangulation,
+                                                                mapping_q_cache->get_degree());
+
+  multigrid_mapping.update(*mapping_multigrid, *mapping_q_cache);
 }
 
+/**
+ * Class used to initialize the mapping for all multigrid h-levels in case of global coarsening.
+ *
+ * As for MultigridMappingLocalSmoothing, the data structures set up in the constructor
+ * (dealii::DoFHandler objects and transfer operators between the coarse grid triangulations)
+ * only depend on the triangulations and the mapping degree, so that update() only recomputes the
+ * grid coordinates on all h-levels if the mesh moves.
+ */
+template<int dim, typename Number>
+class MultigridMappingGlobalCoarsening
+{
+private:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+public:
+  MultigridMappingGlobalCoarsening(
+    std::vector<std::shared_ptr<dealii::Triangulation<dim> const>> const & coarse_triangulations,
+    unsigned int const                                                     mapping_degree)
+    : fe(dealii::FE_Q<dim>(mapping_degree), dim),
+      n_h_levels(coarse_triangulations.size()),
+      coarse_grid_dof_handlers(n_h_levels),
+      coarse_grid_constraints(n_h_levels),
+      transfers(0, n_h_levels - 1),
+      coarse_grid_coordinates(0, n_h_levels - 1)
+  {
+    for(unsigned int i = 0; i < n_h_levels; ++i)
+    {
+      coarse_grid_dof_handlers[i].reinit(*coarse_triangulations[i]);
+      coarse_grid_dof_handlers[i].distribute_dofs(fe);
+      // constraints are irrelevant for interpolation
+      coarse_grid_constraints[i].close();
+    }
+
+    for(unsigned int i = 1; i < n_h_levels; ++i)
+    {
+      transfers[i].reinit_geometric_transfer(coarse_grid_dof_handlers[i],
+                                             coarse_grid_dof_handlers[i - 1],
+                                             coarse_grid_constraints[i],
+                                             coarse_grid_constraints[i - 1]);
+    }
+
+    // a function that initializes the dof-vector for a given level and dof_handler
+    const std::function<void(unsigned int const, VectorType &)> initialize_dof_vector =
+      [&](unsigned int const h_level, VectorType & vector) {
+        dealii::IndexSet locally_relevant_dofs;
+        dealii::DoFTools::extract_locally_relevant_dofs(coarse_grid_dof_handlers[h_level],
+                                                        locally_relevant_dofs);
+        vector.reinit(coarse_grid_dof_handlers[h_level].locally_owned_dofs(),
+                      locally_relevant_dofs,
+                      coarse_grid_dof_handlers[h_level].get_communicator());
+      };
+
+    mg_transfer_global_coarsening =
+      std::make_shared<dealii::MGTransferGlobalCoarsening<dim, VectorType>>(transfers,
+                                                                            initialize_dof_vector);
+  }
+
+  /**
+   * Initializes coarse_grid_mappings for all h-levels according to the grid coordinates described
+   * by mapping_q_cache on the finest h-level. Existing mapping objects are reused.
+   */
+  void
+  update(std::vector<std::shared_ptr<MappingDoFVector<dim, Number>>> & coarse_grid_mappings,
+         dealii::MappingQCache<dim> const &                            mapping_q_cache)
+  {
+    AssertThrow(mapping_q_cache.get_degree() == fe.degree,
+                dealii::ExcMessage("Mapping degree does not match the setup of this object."));
+
+    if(coarse_grid_mappings.size() != n_h_levels)
+    {
+      coarse_grid_mappings.resize(n_h_levels);
+      for(unsigned int h_level = 0; h_level < n_h_levels; ++h_level)
+        coarse_grid_mappings[h_level] =
+          std::make_shared<MappingDoFVector<dim, Number>>(mapping_q_cache.get_degree());
+    }
+
+    // get dof-vector with grid coordinates from the finest h-level
+    coarse_grid_mappings[n_h_levels - 1]->fill_grid_coordinates_vector(
+      mapping_q_cache,
+      coarse_grid_coordinates[n_h_levels - 1],
+      coarse_grid_dof_handlers[n_h_levels - 1]);
+
+    // transfer grid coordinates to coarser h-levels
+    // the dealii::DoFHandler object will not be used for global coarsening
+    dealii::DoFHandler<dim> dof_handler_dummy;
+    VectorType              vector_copy(coarse_grid_coordinates[n_h_levels - 1]);
+    mg_transfer_global_coarsening->interpolate_to_mg(dof_handler_dummy,
+                                                     coarse_grid_coordinates,
+                                                     vector_copy);
+
+    // initialize mapping for all h-levels using the dof-vectors with grid coordinates
+    for(unsigned int h_level = 0; h_level < n_h_levels; ++h_level)
+    {
+      // coarse_grid_coordinates describes absolute coordinates -> use an uninitialized mapping
+      std::shared_ptr<dealii::Mapping<dim> const> mapping_dummy;
+      coarse_grid_mappings[h_level]->initialize_mapping_q_cache(mapping_dummy,
+                                                                coarse_grid_coordinates[h_level],
+                                                                coarse_grid_dof_handlers[h_level]);
+    }
+  }
+
+private:
+  dealii::FESystem<dim> fe;
+
+  unsigned int const n_h_levels;
+
+  std::vector<dealii::DoFHandler<dim>>           coarse_grid_dof_handlers;
+  std::vector<dealii::AffineConstraints<Number>> coarse_grid_constraints;
+
+  dealii::MGLevelObject<dealii::MGTwoLevelTransfer<dim, VectorType>> transfers;
+
+  std::shared_ptr<dealii::MGTransferGlobalCoarsening<dim, VectorType>>
+    mg_transfer_global_coarsening;
+
+  dealii::MGLevelObject<VectorType> coarse_grid_coordinates;
+};
+
 /**
  * Free function used to initialize the mapping for all multigrid h-levels in case of global
- * coarsening.
+ * coarsening. Use MultigridMappingGlobalCoarsening directly to reuse the setup for repeated calls.
  */
 template<int dim, typename Number>
 void
@@ -383,74 +550,13 @@ initialize_multigrid(
   std::shared_ptr<dealii::MappingQCache<dim> const> &                    mapping_q_cache,
   std::vector<std::shared_ptr<dealii::Triangulation<dim> const>> const & coarse_grid_triangulations)
 {
-  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+  MultigridMappingGlobalCoarsening<dim, Number> multigrid_mapping(coarse_grid_triangulations,
+                                                                  mapping_q_cache->get_degree());
 
-  dealii::FESystem<dim>                fe(dealii::FE_Q<dim>(mapping_q_cache->get_degree()), dim);
-  unsigned int const                   n_h_levels = coarse_grid_triangulations.size();
-  std::vector<dealii::DoFHandler<dim>> coarse_grid_dof_handlers(n_h_levels);
-  std::vector<dealii::AffineConstraints<Number>> coarse_grid_constraints(n_h_levels);
-  for(unsigned int i = 0; i < n_h_levels; ++i)
-  {
-    coarse_grid_dof_handlers[i].reinit(*coarse_grid_triangulations[i]);
-    coarse_grid_dof_handlers[i].distribute_dofs(fe);
-    // constraints are irrelevant for interpolation
-    coarse_grid_constraints[i].close();
-  }
-  dealii::MGLevelObject<dealii::MGTwoLevelTransfer<dim, VectorType>> transfers(0, n_h_levels - 1);
-  for(unsigned int i = 1; i < n_h_levels; ++i)
-  {
-    transfers[i].reinit_geometric_transfer(coarse_grid_dof_handlers[i],
-                                           coarse_grid_dof_handlers[i - 1],
-                                           coarse_grid_constraints[i],
-                                           coarse_grid_constraints[i - 1]);
-  }
+  // create new mapping objects
+  coarse_grid_mappings.clear();
 
-  // a function that initializes the dof-vector for a given level and dof_handler
-  const std::function<void(unsigned int const, VectorType &)> initialize_dof_vector =
-    [&](unsigned int const h_level, VectorType & vector) {
-      dealii::IndexSet locally_relevant_dofs;
-      dealii::DoFTools::extract_locally_relevant_dofs(coarse_grid_dof_handlers[h_level],
-                                                      locally_relevant_dofs);
-      vector.reinit(coarse_grid_dof_handlers[h_level].locally_owned_dofs(),
-                    locally_relevant_dofs,
-                    coarse_grid_dof_handlers[h_level].get_communicator());
-    };
-
-  dealii::MGTransferGlobalCoarsening<dim, VectorType> mg_transfer_global_coarsening(
-    transfers, initialize_dof_vector);
-
-  dealii::MGLevelObject<VectorType> coarse_grid_coordinates(0, n_h_levels - 1);
-
-  coarse_grid_mappings.resize(n_h_levels);
-  coarse_grid_mappings[n_h_levels - 1] =
-    std::make_shared<MappingDoFVector<dim, Number>>(mapping_q_cache->get_degree());
-
-  // get dof-vector with grid coordinates from the finest h-level
-  coarse_grid_mappings[n_h_levels - 1]->fill_grid_coordinates_vector(
-    *mapping_q_cache,
-    coarse_grid_coordinates[n_h_levels - 1],
-    coarse_grid_dof_handlers[n_h_levels - 1]);
-
-  // transfer grid coordinates to coarser h-levels
-  // the dealii::DoFHandler object will not be used for global coarsening
-  dealii::DoFHandler<dim> dof_handler_dummy;
-  VectorType              vector_copy(coarse_grid_coordinates[n_h_levels - 1]);
-  mg_transfer_global_coarsening.interpolate_to_mg(dof_handler_dummy,
-                                                  coarse_grid_coordinates,
-                                                  vector_copy);
-
-  // initialize mapping for all h-levels using the dof-vectors with grid coordinates
-  for(unsigned int h_level = 0; h_level < n_h_levels; ++h_level)
-  {
-    coarse_grid_mappings[h_level] =
-      std::make_shared<MappingDoFVector<dim, Number>>(mapping_q_cache->get_degree());
-
-    // coarse_grid_coordinates describes absolute coordinates -> use an uninitialized mapping
-    std::shared_ptr<dealii::Mapping<dim> const> mapping_dummy;
-    coarse_grid_mappings[h_level]->initialize_mapping_q_cache(mapping_dummy,
-                                                              coarse_grid_coordinates[h_level],
-                                                              coarse_grid_dof_handlers[h_level]);
-  }
+  multigrid_mapping.update(coarse_grid_mappings, *mapping_q_cache);
 }
 } // namespace MappingTools
 
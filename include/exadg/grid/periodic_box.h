@@ -32,19 +32,38 @@
 
 namespace ExaDG
 {
+/*
+ * Creates the periodic box [left, right]^dim with n_subdivisions[d] coarse cells in direction d.
+ * Different numbers of subdivisions per direction result in anisotropic cells, e.g. to resolve
+ * the wall-normal direction of wall-bounded flows without refining the other directions. The
+ * aspect ratio of the coarse cells is preserved by the subsequent (isotropic) global refinements.
+ */
 template<int dim>
 void
 create_periodic_box(std::shared_ptr<dealii::Triangulation<dim>>              triangulation,
                     unsigned int const                                       n_refine_space,
                     std::vector<dealii::GridTools::PeriodicFacePair<
                       typename dealii::Triangulation<dim>::cell_iterator>> & periodic_faces,
-                    unsigned int const                                       n_subdivisions,
+                    std::vector<unsigned int> const &                        n_subdivisions,
                     double const                                             left,
                     double const                                             right,
                     bool const   curvilinear_mesh = false,
                     double const deformation      = 0.1)
 {
-  dealii::GridGenerator::subdivided_hyper_cube(*triangulation, n_subdivisions, left, right);
+  AssertThrow(n_subdivisions.size() == dim,
+              dealii::ExcMessage("Number of subdivisions has to be specified for each direction."));
+
+  dealii::Point<dim> point_left, point_right;
+  for(unsigned int d = 0; d < dim; ++d)
+  {
+    point_left[d]  = left;
+    point_right[d] = right;
+  }
+
+  dealii::GridGenerator::subdivided_hyper_rectangle(*triangulation,
+                                                    n_subdivisions,
+                                                    point_left,
+                                                    point_right);
 
   if(curvilinear_mesh)
   {
@@ -106,6 +125,28 @@ create_periodic_box(std::shared_ptr<dealii::Triangulation<dim>>              tri
   triangulation->refine_global(n_refine_space);
 }
 
+template<int dim>
+void
+create_periodic_box(std::shared_ptr<dealii::Triangulation<dim>>              triangulation,
+                    unsigned int const                                       n_refine_space,
+                    std::vector<dealii::GridTools::PeriodicFacePair<
+                      typename dealii::Triangulation<dim>::cell_iterator>> & periodic_faces,
+                    unsigned int const                                       n_subdivisions,
+                    double const                                             left,
+                    double const                                             right,
+                    bool const   curvilinear_mesh = false,
+                    double const deformation      = 0.1)
+{
+  create_periodic_box(triangulation,
+                      n_refine_space,
+                      periodic_faces,
+                      std::vector<unsigned int>(dim, n_subdivisions),
+                      left,
+                      right,
+                      curvilinear_mesh,
+                      deformation);
+}
+
 } // namespace ExaDG
 
 #endif /* APPLICATIONS_GRID_TOOLS_PERIODIC_BOX_H_ */
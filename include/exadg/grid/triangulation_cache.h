@@ -0,0 +1,278 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_GRID_TRIANGULATION_CACHE_H_
+#define INCLUDE_EXADG_GRID_TRIANGULATION_CACHE_H_
+
+// C/C++
+#include <algorithm>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/utilities.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/grid/tria_description.h>
+
+// ExaDG
+#include <exadg/grid/grid_data.h>
+#include <exadg/utilities/create_directories.h>
+
+namespace ExaDG
+{
+namespace GridUtilities
+{
+/**
+ * Adds the bytes of the given data to a 64-bit FNV-1a hash. In contrast to std::hash, the result
+ * does not depend on the compiler or the standard library, so that hashes can be stored on disk
+ * and compared across builds.
+ */
+inline void
+add_to_hash(std::uint64_t & hash, void const * data, std::size_t const n_bytes)
+{
+  unsigned char const * bytes = static_cast<unsigned char const *>(data);
+  for(std::size_t i = 0; i < n_bytes; ++i)
+  {
+    hash ^= bytes[i];
+    hash *= 1099511628211ull;
+  }
+}
+
+inline std::uint64_t
+get_hash(std::string const & string)
+{
+  std::uint64_t hash = 14695981039346656037ull;
+  add_to_hash(hash, string.data(), string.size());
+  return hash;
+}
+
+/**
+ * Returns a checksum of the coarse grid, i.e., of the vertices, material ids, and manifold ids of
+ * the coarse cells and of the boundary ids and manifold ids of their faces. The checksum
+ * identifies the geometry created by the application, which is not reflected by GridData.
+ */
+template<int dim>
+std::uint64_t
+compute_coarse_grid_checksum(dealii::Triangulation<dim> const & triangulation)
+{
+  std::uint64_t hash = get_hash(std::to_string(dim));
+
+  for(auto const & cell : triangulation.cell_iterators_on_level(0))
+  {
+    for(unsigned int const v : cell->vertex_indices())
+    {
+      dealii::Point<dim> const vertex = cell->vertex(v);
+      for(unsigned int d = 0; d < dim; ++d)
+        add_to_hash(hash, &vertex[d], sizeof(double));
+    }
+
+    dealii::types::material_id const material_id = cell->material_id();
+    dealii::types::manifold_id const manifold_id = cell->manifold_id();
+    add_to_hash(hash, &material_id, sizeof(material_id));
+    add_to_hash(hash, &manifold_id, sizeof(manifold_id));
+
+    for(unsigned int const f : cell->face_indices())
+    {
+      dealii::types::boundary_id const face_boundary_id = cell->face(f)->boundary_id();
+      dealii::types::manifold_id const face_manifold_id = cell->face(f)->manifold_id();
+      add_to_hash(hash, &face_boundary_id, sizeof(face_boundary_id));
+      add_to_hash(hash, &face_manifold_id, sizeof(face_manifold_id));
+    }
+  }
+
+  return hash;
+}
+
+/**
+ * Returns the name (without process-specific suffix) under which the triangulation created for
+ * the given parameters is stored in the setup cache, see GridData::setup_cache_directory. The name
+ * is a hash of the dimension, the checksum of the coarse grid (see compute_coarse_grid_checksum()),
+ * and all parameters that determine the refinements and the partitioning of the triangulation.
+ */
+template<int dim>
+std::string
+get_triangulation_cache_file_name(GridData const &                  data,
+                                  std::uint64_t const               coarse_grid_checksum,
+                                  unsigned int const                global_refinements,
+                                  std::vector<unsigned int> const & vector_local_refinements,
+                                  MPI_Comm const &                  mpi_comm)
+{
+  unsigned int const n_mpi_processes = dealii::Utilities::MPI::n_mpi_processes(mpi_comm);
+
+  std::ostringstream key;
+  key << dim << "_" << coarse_grid_checksum << "_" << data.file_name << "_"
+      << (int)data.triangulation_type << "_" << (int)data.element_type << "_"
+      << (int)data.partitioning_type << "_" << data.n_mpi_processes_per_group << "_"
+      << (int)data.multigrid << "_" << global_refinements;
+  for(auto const n_local_refinements : vector_local_refinements)
+    key << "_" << n_local_refinements;
+
+  std::ostringstream file_name;
+  file_name << data.setup_cache_directory << "/triangulation_" << dim << "d_" << std::hex
+            << get_hash(key.str()) << std::dec << "_np" << n_mpi_processes;
+
+  return file_name.str();
+}
+
+/**
+ * Returns a random suffix for temporary files, which is the same on all MPI processes. Files of
+ * the setup cache are first written under a temporary name and then renamed, so that a run that
+ * crashes, or several runs that write the same cache entry concurrently, never leave a truncated
+ * file under the final name.
+ */
+inline std::string
+get_temporary_file_suffix(MPI_Comm const & mpi_comm)
+{
+  std::random_device                           random_device;
+  std::uniform_int_distribution<std::uint64_t> distribution;
+
+  std::uint64_t random_number = distribution(random_device);
+
+  int const ierr = MPI_Bcast(&random_number, 1, MPI_UINT64_T, 0, mpi_comm);
+  AssertThrowMPI(ierr);
+
+  std::ostringstream suffix;
+  suffix << ".tmp" << std::hex << random_number;
+  return suffix.str();
+}
+
+/**
+ * Renames all files starting with temporary_file_name such that they start with file_name. The
+ * file ending with ".info" is renamed last since its existence marks a complete cache entry, see
+ * parallel::distributed::Triangulation::save(). Has to be called by all MPI processes after the
+ * files have been written, the files are renamed by the first process.
+ */
+inline void
+rename_saved_files(std::string const & temporary_file_name,
+                   std::string const & file_name,
+                   MPI_Comm const &    mpi_comm)
+{
+  int ierr = MPI_Barrier(mpi_comm);
+  AssertThrowMPI(ierr);
+
+  if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
+  {
+    std::filesystem::path const temporary_path(temporary_file_name);
+    std::string const           temporary_prefix = temporary_path.filename().string();
+
+    std::vector<std::filesystem::path> files;
+    for(auto const & entry : std::filesystem::directory_iterator(temporary_path.parent_path()))
+    {
+      std::string const name = entry.path().filename().string();
+      if(name.compare(0, temporary_prefix.size(), temporary_prefix) == 0)
+        files.push_back(entry.path());
+    }
+
+    std::stable_partition(files.begin(), files.end(), [](std::filesystem::path const & path) {
+      return path.extension() != ".info";
+    });
+
+    for(auto const & path : files)
+    {
+      std::string const name = path.filename().string();
+      std::filesystem::rename(path,
+                              file_name + name.substr(temporary_prefix.size(), std::string::npos));
+    }
+  }
+
+  ierr = MPI_Barrier(mpi_comm);
+  AssertThrowMPI(ierr);
+}
+
+/**
+ * Returns true if the file exists for all MPI processes of the communicator.
+ */
+inline bool
+cache_file_exists(std::string const & file_name, MPI_Comm const & mpi_comm)
+{
+  unsigned int const exists = std::filesystem::exists(file_name) ? 1 : 0;
+
+  return dealii::Utilities::MPI::min(exists, mpi_comm) == 1;
+}
+
+/**
+ * Returns the description of the locally relevant part of a fully-distributed triangulation. If
+ * GridData::setup_cache_directory is set and the setup cache contains the description under the
+ * given file name (see get_triangulation_cache_file_name()), the description is read from the
+ * cache. Otherwise, the description is created by the function create_description and stored in
+ * the cache.
+ */
+template<int dim>
+dealii::TriangulationDescription::Description<dim, dim>
+create_description_with_cache(
+  std::function<dealii::TriangulationDescription::Description<dim, dim>()> const &
+                      create_description,
+  GridData const &    data,
+  std::string const & cache_file_name,
+  MPI_Comm const &    mpi_comm)
+{
+  if(data.setup_cache_directory.empty())
+    return create_description();
+
+  // every MPI process stores the description of its own part of the triangulation
+  std::string const file_name =
+    cache_file_name + "_" + std::to_string(dealii::Utilities::MPI::this_mpi_process(mpi_comm)) +
+    ".data";
+
+  dealii::TriangulationDescription::Description<dim, dim> description;
+
+  if(cache_file_exists(file_name, mpi_comm))
+  {
+    std::ifstream     file(file_name, std::ios::binary);
+    std::vector<char> buffer((std::istreambuf_iterator<char>(file)),
+                             std::istreambuf_iterator<char>());
+
+    description =
+      dealii::Utilities::unpack<dealii::TriangulationDescription::Description<dim, dim>>(buffer,
+                                                                                        false);
+  }
+  else
+  {
+    description = create_description();
+
+    create_directories(data.setup_cache_directory, mpi_comm);
+
+    std::vector<char> const buffer = dealii::Utilities::pack(description, false);
+
+    std::string const temporary_file_name = file_name + get_temporary_file_suffix(mpi_comm);
+    {
+      std::ofstream file(temporary_file_name, std::ios::binary);
+      file.write(buffer.data(), buffer.size());
+      AssertThrow(file.good(),
+                  dealii::ExcMessage("Could not write file " + temporary_file_name + "."));
+    }
+    std::filesystem::rename(temporary_file_name, file_name);
+  }
+
+  return description;
+}
+
+} // namespace GridUtilities
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_GRID_TRIANGULATION_CACHE_H_ */
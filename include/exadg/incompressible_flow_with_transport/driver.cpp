@@ -131,7 +131,7 @@ Driver<dim, Number>::setup()
   }
 
   // initialize matrix_free
-  matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>();
+  matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>(*application->get_grid());
   matrix_free_data->append(fluid_operator);
   for(unsigned int i = 0; i < n_scalars; ++i)
     matrix_free_data->append(scalar_operator[i]);
@@ -306,6 +306,8 @@ Driver<dim, Number>::setup()
     }
   }
 
+  setup_batched_scalars();
+
   // Boussinesq term
   // assume that the first scalar quantity with index 0 is the active scalar coupled to
   // the incompressible Navier-Stokes equations via the Boussinesq term
@@ -315,6 +317,80 @@ Driver<dim, Number>::setup()
   timer_tree.insert({"Flow + transport", "Setup"}, timer.wall_time());
 }
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::setup_batched_scalars()
+{
+  unsigned int const n_scalars = application->get_n_scalars();
+
+  scalar_is_batched.resize(n_scalars, false);
+
+  unsigned int first = dealii::numbers::invalid_unsigned_int;
+  for(unsigned int i = 0; i < n_scalars; ++i)
+  {
+    ConvDiff::Parameters const & param_i = application->get_parameters_scalar(i);
+
+    if(param_i.solve_batched == false)
+      continue;
+
+    if(first == dealii::numbers::invalid_unsigned_int)
+      first = i;
+
+    // the operator of the first batched scalar is used for all batched scalars, so that the
+    // discretization and the boundary types have to coincide
+    ConvDiff::Parameters const & param_first = application->get_parameters_scalar(first);
+
+    AssertThrow(param_i.equation_type == param_first.equation_type and
+                  param_i.degree == param_first.degree and
+                  std::abs(param_i.diffusivity - param_first.diffusivity) <=
+                    1.e-12 * std::abs(param_first.diffusivity) and
+                  param_i.order_time_integrator == param_first.order_time_integrator and
+                  param_i.start_with_low_order == param_first.start_with_low_order and
+                  std::abs(param_i.start_time - param_first.start_time) <
+                    1.e-12 * std::abs(param_first.end_time) and
+                  std::abs(param_i.end_time - param_first.end_time) <
+                    1.e-12 * std::abs(param_first.end_time),
+                dealii::ExcMessage("Scalars solved batched need to use identical parameters."));
+
+    // the linear solver and the preconditioner of the first batched scalar are used for all
+    // batched scalars
+    AssertThrow(param_i.solver_data.max_iter == param_first.solver_data.max_iter and
+                  param_i.solver_data.abs_tol == param_first.solver_data.abs_tol and
+                  param_i.solver_data.rel_tol == param_first.solver_data.rel_tol and
+                  param_i.preconditioner == param_first.preconditioner and
+                  param_i.update_preconditioner == param_first.update_preconditioner and
+                  param_i.update_preconditioner_every_time_steps ==
+                    param_first.update_preconditioner_every_time_steps and
+                  param_i.implement_block_diagonal_preconditioner_matrix_free ==
+                    param_first.implement_block_diagonal_preconditioner_matrix_free and
+                  param_i.mg_operator_type == param_first.mg_operator_type and
+                  param_i.multigrid_data.type == param_first.multigrid_data.type,
+                dealii::ExcMessage("Scalars solved batched need to use identical solver and "
+                                   "preconditioner settings."));
+
+    auto const get_boundary_ids = [&](unsigned int const scalar_index) {
+      std::shared_ptr<ConvDiff::BoundaryDescriptor<dim> const> boundary_descriptor =
+        application->get_boundary_descriptor_scalar(scalar_index);
+
+      std::pair<std::set<dealii::types::boundary_id>, std::set<dealii::types::boundary_id>> ids;
+      for(auto const & iter : boundary_descriptor->dirichlet_bc)
+        ids.first.insert(iter.first);
+      for(auto const & iter : boundary_descriptor->neumann_bc)
+        ids.second.insert(iter.first);
+
+      return ids;
+    };
+
+    AssertThrow(get_boundary_ids(i) == get_boundary_ids(first),
+                dealii::ExcMessage("Scalars solved batched need to use identical boundary types."));
+
+    scalar_is_batched[i] = true;
+
+    batched_scalar_time_integrator.push_back(
+      std::dynamic_pointer_cast<ConvDiff::TimeIntBDF<dim, Number>>(scalar_time_integrator[i]));
+  }
+}
+
 template<int dim, typename Number>
 void
 Driver<dim, Number>::set_start_time() const
@@ -589,7 +665,14 @@ Driver<dim, Number>::solve() const
 
     // scalar transport: advance one time step
     for(unsigned int i = 0; i < application->get_n_scalars(); ++i)
-      scalar_time_integrator[i]->advance_one_timestep_solve();
+    {
+      if(scalar_is_batched[i] == false)
+        scalar_time_integrator[i]->advance_one_timestep_solve();
+    }
+
+    if(batched_scalar_time_integrator.size() > 0)
+      ConvDiff::TimeIntBDF<dim, Number>::advance_one_timestep_solve_batched(
+        batched_scalar_time_integrator);
 
     /*
      * post solve
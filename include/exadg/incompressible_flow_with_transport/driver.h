@@ -84,6 +84,9 @@ private:
   void
   synchronize_time_step_size() const;
 
+  void
+  setup_batched_scalars();
+
   // MPI communicator
   MPI_Comm const mpi_comm;
 
@@ -128,6 +131,12 @@ private:
 
   std::vector<std::shared_ptr<TimeIntBase>> scalar_time_integrator;
 
+  // scalar fields whose linear systems are solved simultaneously (ConvDiff::Parameters::
+  // solve_batched), using the operator of the first of these fields
+  std::vector<bool> scalar_is_batched;
+
+  std::vector<std::shared_ptr<ConvDiff::TimeIntBDF<dim, Number>>> batched_scalar_time_integrator;
+
   mutable dealii::LinearAlgebra::distributed::Vector<Number> temperature;
 
   /*
@@ -25,7 +25,9 @@
 #endif
 
 // ExaDG
+#include <exadg/grid/adaptive_mesh_refinement.h>
 #include <exadg/grid/get_dynamic_mapping.h>
+#include <exadg/grid/load_balancing.h>
 #include <exadg/incompressible_navier_stokes/driver.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/create_operator.h>
 #include <exadg/incompressible_navier_stokes/time_integration/create_time_integrator.h>
@@ -60,6 +62,11 @@ Driver<dim, Number>::setup()
   pcout << std::endl << "Setting up incompressible Navier-Stokes solver:" << std::endl;
 
   application->setup();
+  timer_tree.insert({"Incompressible flow", "Setup", "Create grid"},
+                    application->get_wall_time_create_grid());
+
+  if(application->get_parameters().use_load_balancing)
+    setup_load_balancing();
 
   // moving mesh (ALE formulation)
   if(application->get_parameters().ale_formulation)
@@ -90,7 +97,8 @@ Driver<dim, Number>::setup()
         mpi_comm);
 
       // initialize matrix_free
-      poisson_matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>();
+      poisson_matrix_free_data =
+        std::make_shared<MatrixFreeData<dim, Number>>(*application->get_grid());
       poisson_matrix_free_data->append(poisson_operator);
 
       poisson_matrix_free = std::make_shared<dealii::MatrixFree<dim, Number>>();
@@ -106,9 +114,10 @@ Driver<dim, Number>::setup()
       poisson_operator->setup(poisson_matrix_free, poisson_matrix_free_data);
       poisson_operator->setup_solver();
 
-      grid_motion =
-        std::make_shared<GridMotionPoisson<dim, Number>>(application->get_grid()->mapping,
-                                                         poisson_operator);
+      grid_motion = std::make_shared<GridMotionPoisson<dim, Number>>(
+        application->get_grid()->mapping,
+        poisson_operator,
+        application->get_parameters().mesh_movement_tolerance);
     }
     else
     {
@@ -143,7 +152,7 @@ Driver<dim, Number>::setup()
   }
 
   // initialize matrix_free
-  matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>();
+  matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>(*application->get_grid());
   matrix_free_data->append(pde_operator);
 
   matrix_free = std::make_shared<dealii::MatrixFree<dim, Number>>();
@@ -222,18 +231,23 @@ Driver<dim, Number>::ale_update() const
   dealii::Timer sub_timer;
 
   sub_timer.restart();
-  grid_motion->update(time_integrator->get_next_time(), false);
+  bool const mapping_has_changed = grid_motion->update(time_integrator->get_next_time(), false);
   timer_tree.insert({"Incompressible flow", "ALE", "Reinit mapping"}, sub_timer.wall_time());
 
-  sub_timer.restart();
-  std::shared_ptr<dealii::Mapping<dim> const> mapping =
-    get_dynamic_mapping<dim, Number>(application->get_grid(), grid_motion);
-  matrix_free->update_mapping(*mapping);
-  timer_tree.insert({"Incompressible flow", "ALE", "Update matrix-free"}, sub_timer.wall_time());
-
-  sub_timer.restart();
-  pde_operator->update_after_grid_motion();
-  timer_tree.insert({"Incompressible flow", "ALE", "Update operator"}, sub_timer.wall_time());
+  // geometry-dependent data structures only need to be updated if the mesh has moved
+  if(mapping_has_changed)
+  {
+    sub_timer.restart();
+    std::shared_ptr<dealii::Mapping<dim> const> mapping =
+      get_dynamic_mapping<dim, Number>(application->get_grid(), grid_motion);
+    matrix_free->update_mapping(*mapping);
+    timer_tree.insert({"Incompressible flow", "ALE", "Update matrix-free"},
+                      sub_timer.wall_time());
+
+    sub_timer.restart();
+    pde_operator->update_after_grid_motion();
+    timer_tree.insert({"Incompressible flow", "ALE", "Update operator"}, sub_timer.wall_time());
+  }
 
   sub_timer.restart();
   time_integrator->ale_update();
@@ -243,6 +257,140 @@ Driver<dim, Number>::ale_update() const
   timer_tree.insert({"Incompressible flow", "ALE"}, timer.wall_time());
 }
 
+template<int dim, typename Number>
+void
+Driver<dim, Number>::setup_load_balancing() const
+{
+  Parameters const & param = application->get_parameters();
+
+  dealii::Triangulation<dim> & triangulation = *application->get_grid()->triangulation;
+
+  connect_cell_weight(triangulation,
+                      param.load_balancing_data,
+                      application->get_grid()->additional_cell_weight);
+
+  // the initial partitioning is based on the number of cells, no data needs to be transferred
+  // since the degrees of freedom have not been distributed yet
+  double const imbalance = compute_load_imbalance(triangulation,
+                                                  param.load_balancing_data,
+                                                  application->get_grid()->additional_cell_weight);
+
+  print_parameter(pcout, "Load imbalance of initial partitioning", imbalance);
+
+  if(imbalance > param.load_balancing_data.imbalance_tolerance)
+  {
+    dynamic_cast<dealii::parallel::distributed::Triangulation<dim> &>(triangulation).repartition();
+
+    print_parameter(pcout,
+                    "Load imbalance after repartitioning",
+                    compute_load_imbalance(triangulation,
+                                           param.load_balancing_data,
+                                           application->get_grid()->additional_cell_weight));
+  }
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::do_adaptive_mesh_refinement() const
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  Parameters const & param = application->get_parameters();
+
+  dealii::Triangulation<dim> & triangulation = *application->get_grid()->triangulation;
+
+  pcout << std::endl
+        << "Adaptive mesh refinement at t = " << time_integrator->get_time() << ":" << std::endl;
+
+  // mark cells according to the refinement indicator of the current velocity
+  dealii::Vector<float> indicators;
+  compute_refinement_indicator(indicators,
+                               pde_operator->get_dof_handler_u(),
+                               *pde_operator->get_mapping(),
+                               time_integrator->get_velocity(),
+                               param.adaptive_mesh_refinement_data.refinement_indicator);
+
+  mark_cells_for_coarsening_and_refinement(triangulation,
+                                           indicators,
+                                           param.adaptive_mesh_refinement_data);
+
+  // adapt triangulation and transfer the solution vectors
+  time_integrator->prepare_coarsening_and_refinement();
+
+  triangulation.execute_coarsening_and_refinement();
+
+  print_parameter(pcout, "number of cells (total)", triangulation.n_global_active_cells());
+
+  setup_after_coarsening_and_refinement();
+
+  timer_tree.insert({"Incompressible flow", "Adaptive mesh refinement"}, timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::do_repartitioning() const
+{
+  dealii::Timer timer;
+  timer.restart();
+
+  Parameters const & param = application->get_parameters();
+
+  dealii::Triangulation<dim> & triangulation = *application->get_grid()->triangulation;
+
+  double const imbalance = compute_load_imbalance(triangulation,
+                                                  param.load_balancing_data,
+                                                  application->get_grid()->additional_cell_weight);
+
+  if(imbalance > param.load_balancing_data.imbalance_tolerance)
+  {
+    pcout << std::endl
+          << "Repartitioning at t = " << time_integrator->get_time() << ":" << std::endl;
+
+    print_parameter(pcout, "Load imbalance before repartitioning", imbalance);
+
+    // repartition triangulation and transfer the solution vectors
+    time_integrator->prepare_coarsening_and_refinement();
+
+    dynamic_cast<dealii::parallel::distributed::Triangulation<dim> &>(triangulation).repartition();
+
+    setup_after_coarsening_and_refinement();
+
+    print_parameter(pcout,
+                    "Load imbalance after repartitioning",
+                    compute_load_imbalance(triangulation,
+                                           param.load_balancing_data,
+                                           application->get_grid()->additional_cell_weight));
+  }
+
+  timer_tree.insert({"Incompressible flow", "Repartitioning"}, timer.wall_time());
+}
+
+template<int dim, typename Number>
+void
+Driver<dim, Number>::setup_after_coarsening_and_refinement() const
+{
+  pde_operator->distribute_dofs_after_coarsening_and_refinement();
+
+  // set up data structures depending on the degrees of freedom
+  if(application->get_parameters().use_cell_based_face_loops)
+    Categorization::do_cell_based_loops(*application->get_grid()->triangulation,
+                                        matrix_free_data->data);
+  matrix_free->reinit(*pde_operator->get_mapping(),
+                      matrix_free_data->get_dof_handler_vector(),
+                      matrix_free_data->get_constraint_vector(),
+                      matrix_free_data->get_quadrature_vector(),
+                      matrix_free_data->data);
+
+  pde_operator->setup(matrix_free, matrix_free_data);
+
+  time_integrator->interpolate_after_coarsening_and_refinement();
+
+  postprocessor->reinit_after_coarsening_and_refinement();
+
+  pde_operator->setup_solvers(time_integrator->get_scaling_factor_time_derivative_term(),
+                              time_integrator->get_velocity());
+}
 
 template<int dim, typename Number>
 void
@@ -266,6 +414,25 @@ Driver<dim, Number>::solve() const
         time_integrator->advance_one_timestep_post_solve();
       }
     }
+    else if(application->get_parameters().use_adaptive_mesh_refinement or
+            application->get_parameters().use_load_balancing)
+    {
+      Parameters const & param = application->get_parameters();
+
+      while(not time_integrator->finished())
+      {
+        unsigned int const n_time_steps = time_integrator->get_number_of_time_steps();
+
+        if(param.use_adaptive_mesh_refinement and
+           param.adaptive_mesh_refinement_data.do_coarsening_and_refinement(n_time_steps))
+          do_adaptive_mesh_refinement();
+
+        if(param.use_load_balancing and param.load_balancing_data.do_repartitioning(n_time_steps))
+          do_repartitioning();
+
+        time_integrator->advance_one_timestep();
+      }
+    }
     else
     {
       time_integrator->timeloop();
@@ -137,7 +137,8 @@ DriverPrecursor<dim, Number>::setup()
 
 
   // initialize matrix_free precursor
-  matrix_free_data_pre = std::make_shared<MatrixFreeData<dim, Number>>();
+  matrix_free_data_pre =
+    std::make_shared<MatrixFreeData<dim, Number>>(*application->get_grid_precursor());
   matrix_free_data_pre->append(pde_operator_pre);
 
   matrix_free_pre = std::make_shared<dealii::MatrixFree<dim, Number>>();
@@ -151,7 +152,7 @@ DriverPrecursor<dim, Number>::setup()
                           matrix_free_data_pre->data);
 
   // initialize matrix_free
-  matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>();
+  matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>(*application->get_grid());
   matrix_free_data->append(pde_operator);
 
   matrix_free = std::make_shared<dealii::MatrixFree<dim, Number>>();
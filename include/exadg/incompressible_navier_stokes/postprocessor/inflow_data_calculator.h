@@ -31,6 +31,7 @@
 
 // ExaDG
 #include <exadg/utilities/print_functions.h>
+#include <exadg/vector_tools/point_evaluation_plan.h>
 
 namespace ExaDG
 {
@@ -116,11 +117,9 @@ private:
 
   MPI_Comm const mpi_comm;
 
-  std::vector<
-    std::vector<std::pair<std::vector<dealii::types::global_dof_index>, std::vector<Number>>>>
-    array_dof_indices_and_shape_values;
+  PointEvaluationPlan<dim, dim, Number> point_evaluation_plan;
 
-  std::vector<unsigned int> array_counter;
+  std::vector<dealii::Tensor<1, dim, Number>> velocity_values;
 };
 
 } // namespace IncNS
@@ -399,6 +399,15 @@ PostProcessor<dim, Number>::initialize_derived_fields()
   }
 }
 
+template<int dim, typename Number>
+void
+PostProcessor<dim, Number>::reinit_after_coarsening_and_refinement()
+{
+  // derived fields are recomputed from the transferred solution, except for the time-averaged
+  // velocity field which is reset on the new mesh
+  initialize_derived_fields();
+}
+
 template<int dim, typename Number>
 void
 PostProcessor<dim, Number>::invalidate_derived_fields()
@@ -74,6 +74,9 @@ public:
   void
   setup(Operator const & pde_operator) override;
 
+  void
+  reinit_after_coarsening_and_refinement() override;
+
   void
   do_postprocessing(VectorType const &     velocity,
                     VectorType const &     pressure,
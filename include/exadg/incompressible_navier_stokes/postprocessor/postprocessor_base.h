@@ -52,6 +52,15 @@ public:
    */
   virtual void
   setup(Operator const & pde_operator) = 0;
+
+  /*
+   * Re-initializes data structures that depend on the degrees of freedom after the triangulation
+   * has been changed by adaptive mesh refinement.
+   */
+  virtual void
+  reinit_after_coarsening_and_refinement()
+  {
+  }
 };
 
 
@@ -19,6 +19,10 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <array>
+
+// ExaDG
 #include <exadg/incompressible_navier_stokes/preconditioners/multigrid_preconditioner_momentum.h>
 #include <exadg/incompressible_navier_stokes/spatial_discretization/operator_coupled.h>
 #include <exadg/poisson/preconditioners/multigrid_preconditioner.h>
@@ -48,7 +52,8 @@ OperatorCoupled<dim, Number>::OperatorCoupled(
          parameters_in,
          field_in,
          mpi_comm_in),
-    scaling_factor_continuity(1.0)
+    scaling_factor_continuity(1.0),
+    scaling_factor_mass_last_preconditioner_update(1.0)
 {
 }
 
@@ -273,6 +278,39 @@ OperatorCoupled<dim, Number>::solve_nonlinear_problem(BlockVectorType &  dst,
   return iter;
 }
 
+template<int dim, typename Number>
+unsigned int
+OperatorCoupled<dim, Number>::perform_newton_step(BlockVectorType &  dst,
+                                                  VectorType const & rhs_vector,
+                                                  bool const &       update_preconditioner,
+                                                  double const &     time,
+                                                  double const &     scaling_factor_mass)
+{
+  // Update nonlinear operator
+  nonlinear_operator.update(rhs_vector, time, scaling_factor_mass);
+
+  // Update linear operator
+  linear_operator.update(time, scaling_factor_mass);
+
+  BlockVectorType residual, increment;
+  residual.reinit(dst);
+  increment.reinit(dst);
+
+  // the linearized problem reads "linear_operator * increment = - residual"
+  nonlinear_operator.evaluate_residual(residual, dst);
+  residual *= -1.0;
+
+  // set linearization point and update preconditioner if requested
+  linear_operator.set_solution_linearization(dst);
+  linear_solver->update_preconditioner(update_preconditioner);
+
+  unsigned int const n_iter = linear_solver->solve(increment, residual);
+
+  dst.add(1.0, increment);
+
+  return n_iter;
+}
+
 template<int dim, typename Number>
 void
 OperatorCoupled<dim, Number>::evaluate_nonlinear_residual(BlockVectorType &       dst,
@@ -389,6 +427,13 @@ OperatorCoupled<dim, Number>::initialize_block_preconditioner()
   initialize_preconditioner_velocity_block();
 
   initialize_preconditioner_pressure_block();
+
+  if(this->param.update_preconditioner_coupled_velocity_tolerance > 0.0)
+  {
+    this->initialize_vector_velocity(velocity_last_preconditioner_update);
+    scaling_factor_mass_last_preconditioner_update =
+      this->momentum_operator.get_scaling_factor_mass_operator();
+  }
 }
 
 template<int dim, typename Number>
@@ -475,6 +520,18 @@ OperatorCoupled<dim, Number>::setup_multigrid_preconditioner_momentum()
       pair(iter.first, new dealii::Functions::ZeroFunction<dim>(dim)));
   }
 
+  // In case of H(div)-conforming elements, the normal velocity is imposed strongly on symmetry
+  // boundaries. From the perspective of multigrid, this corresponds to homogeneous Dirichlet
+  // constraints for all degrees of freedom on these boundaries.
+  if(this->param.spatial_discretization == SpatialDiscretization::HDIV)
+  {
+    for(auto iter : this->momentum_operator.get_data().bc->symmetry_bc)
+    {
+      dirichlet_boundary_conditions.insert(
+        std::make_pair(iter.first, std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim)));
+    }
+  }
+
   typedef std::map<dealii::types::boundary_id, dealii::ComponentMask> Map_DBC_ComponentMask;
   Map_DBC_ComponentMask                                               dirichlet_bc_component_mask;
 
@@ -843,6 +900,10 @@ template<int dim, typename Number>
 void
 OperatorCoupled<dim, Number>::update_block_preconditioner()
 {
+  // The preconditioner is reused as long as the velocity field changes slowly.
+  if(not linearized_operator_has_changed())
+    return;
+
   // momentum block
   preconditioner_momentum->update();
 
@@ -874,6 +935,60 @@ OperatorCoupled<dim, Number>::update_block_preconditioner()
   }
 }
 
+template<int dim, typename Number>
+bool
+OperatorCoupled<dim, Number>::linearized_operator_has_changed()
+{
+  double const tolerance = this->param.update_preconditioner_coupled_velocity_tolerance;
+
+  // The mesh has to be updated in any case for moving meshes, and the preconditioner does not
+  // depend on the velocity if the convective term is not treated implicitly.
+  if(tolerance <= 0.0 or this->param.ale_formulation or
+     not this->param.nonlinear_problem_has_to_be_solved())
+  {
+    return true;
+  }
+
+  // The scaling factor of the mass operator changes with the time step size (adaptive time
+  // stepping, pseudo-time stepping of steady problems) and enters the momentum preconditioner.
+  double const scaling_factor_mass = this->momentum_operator.get_scaling_factor_mass_operator();
+
+  bool has_changed = (scaling_factor_mass != scaling_factor_mass_last_preconditioner_update);
+
+  VectorType const & velocity = this->convective_kernel->get_velocity();
+
+  if(not has_changed)
+  {
+    // norms of the velocity and of the difference to the velocity at the last update
+    std::array<double, 2> sums = {{0.0, 0.0}};
+    for(unsigned int i = 0; i < velocity.locally_owned_size(); ++i)
+    {
+      double const difference =
+        velocity.local_element(i) - velocity_last_preconditioner_update.local_element(i);
+      sums[0] += velocity.local_element(i) * velocity.local_element(i);
+      sums[1] += difference * difference;
+    }
+
+    dealii::Utilities::MPI::sum(dealii::ArrayView<double const>(sums.data(), sums.size()),
+                                velocity.get_mpi_communicator(),
+                                dealii::ArrayView<double>(sums.data(), sums.size()));
+
+    double const norm_velocity   = std::sqrt(sums[0]);
+    double const norm_difference = std::sqrt(sums[1]);
+
+    has_changed = (norm_velocity > 0.0) ? (norm_difference > tolerance * norm_velocity) :
+                                          (norm_difference > 0.0);
+  }
+
+  if(has_changed)
+  {
+    velocity_last_preconditioner_update.copy_locally_owned_data_from(velocity);
+    scaling_factor_mass_last_preconditioner_update = scaling_factor_mass;
+  }
+
+  return has_changed;
+}
+
 template<int dim, typename Number>
 void
 OperatorCoupled<dim, Number>::apply_block_preconditioner(BlockVectorType &       dst,
@@ -1096,37 +1211,46 @@ OperatorCoupled<dim, Number>::apply_preconditioner_pressure_block(VectorType &
 {
   auto type = this->param.preconditioner_pressure_block;
 
+  // scaling_factor_continuity: Since the Schur complement includes both the velocity divergence
+  // and the pressure gradient operators as factors, we have to scale by
+  // 1/(scaling_factor*scaling_factor) when applying (an approximation of) the inverse Schur
+  // complement. This factor is merged into the scaling of the individual contributions below to
+  // avoid additional sweeps over the vectors.
+  double const inverse_scaling_factor = 1.0 / scaling_factor_continuity;
+  double const scaling                = inverse_scaling_factor * inverse_scaling_factor;
+
   if(type == SchurComplementPreconditioner::None)
   {
     // No preconditioner for Schur-complement block
-    dst = src;
+    dst.equ(scaling, src);
   }
   else if(type == SchurComplementPreconditioner::InverseMassMatrix)
   {
     // - S^{-1} = nu M_p^{-1}
     inverse_mass_preconditioner_schur_complement->vmult(dst, src);
-    dst *= this->get_viscosity();
+    dst *= scaling * this->get_viscosity();
   }
   else if(type == SchurComplementPreconditioner::LaplaceOperator)
   {
     // -S^{-1} = 1/dt  (-L)^{-1}
     apply_inverse_negative_laplace_operator(dst, src);
-    dst *= this->momentum_operator.get_scaling_factor_mass_operator();
+    dst *= scaling * this->momentum_operator.get_scaling_factor_mass_operator();
   }
   else if(type == SchurComplementPreconditioner::CahouetChabard)
   {
     // - S^{-1} = nu M_p^{-1} + 1/dt (-L)^{-1}
 
-    // I. 1/dt (-L)^{-1}
+    // I. (-L)^{-1}
     apply_inverse_negative_laplace_operator(dst, src);
-    dst *= this->momentum_operator.get_scaling_factor_mass_operator();
 
     // II. M_p^{-1}, apply inverse pressure mass operator to src-vector and store the result in a
     // temporary vector
     inverse_mass_preconditioner_schur_complement->vmult(tmp_scp_pressure, src);
 
-    // III. add temporary vector scaled by viscosity
-    dst.add(this->get_viscosity(), tmp_scp_pressure);
+    // III. scale (-L)^{-1} by 1/dt and add temporary vector scaled by viscosity in a single sweep
+    dst.sadd(scaling * this->momentum_operator.get_scaling_factor_mass_operator(),
+             scaling * this->get_viscosity(),
+             tmp_scp_pressure);
   }
   else if(type == SchurComplementPreconditioner::PressureConvectionDiffusion)
   {
@@ -1149,18 +1273,12 @@ OperatorCoupled<dim, Number>::apply_preconditioner_pressure_block(VectorType &
 
     // III. inverse pressure mass operator M_p^{-1}
     inverse_mass_preconditioner_schur_complement->vmult(dst, dst);
+    dst *= scaling;
   }
   else
   {
     AssertThrow(false, dealii::ExcNotImplemented());
   }
-
-  // scaling_factor_continuity: Since the Schur complement includes both the velocity divergence
-  // and the pressure gradient operators as factors, we have to scale by
-  // 1/(scaling_factor*scaling_factor) when applying (an approximation of) the inverse Schur
-  // complement.
-  double inverse_scaling_factor = 1.0 / scaling_factor_continuity;
-  dst *= inverse_scaling_factor * inverse_scaling_factor;
 }
 
 template<int dim, typename Number>
@@ -274,6 +274,18 @@ public:
                           double const &     scaling_factor_mass = 1.0);
 
 
+  /*
+   * This function performs a single (undamped) Newton step for the nonlinear problem, which is
+   * needed for pseudo-transient continuation. The function returns the number of iterations of the
+   * linear solver.
+   */
+  unsigned int
+  perform_newton_step(BlockVectorType &  dst,
+                      VectorType const & rhs_vector,
+                      bool const &       update_preconditioner,
+                      double const &     time,
+                      double const &     scaling_factor_mass);
+
   /*
    * This function evaluates the nonlinear residual.
    */
@@ -365,6 +377,14 @@ private:
   void
   apply_inverse_negative_laplace_operator(VectorType & dst, VectorType const & src) const;
 
+  /*
+   * Returns true if the scaling factor of the mass operator has changed or the linearization
+   * velocity has changed by more than the specified tolerance since the last update of the block
+   * preconditioner, so that an update is necessary.
+   */
+  bool
+  linearized_operator_has_changed();
+
   /*
    * Newton-Krylov solver for (non-)linear problem
    */
@@ -418,6 +438,12 @@ private:
   // temporary vectors that are necessary when applying the Schur-complement preconditioner (scp)
   VectorType mutable tmp_scp_pressure;
   VectorType mutable tmp_scp_velocity, tmp_scp_velocity_2;
+
+  // linearization velocity and scaling factor of the mass operator at the time of the last update
+  // of the block preconditioner (only needed if the preconditioner is reused as long as the
+  // velocity changes slowly)
+  VectorType velocity_last_preconditioner_update;
+  double     scaling_factor_mass_last_preconditioner_update;
 };
 
 } // namespace IncNS
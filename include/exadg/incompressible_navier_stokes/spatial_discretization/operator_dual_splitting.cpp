@@ -133,6 +133,18 @@ OperatorDualSplitting<dim, Number>::initialize_helmholtz_preconditioner()
         pair(iter.first, new dealii::Functions::ZeroFunction<dim>(dim)));
     }
 
+    // In case of H(div)-conforming elements, the normal velocity is imposed strongly on symmetry
+    // boundaries. From the perspective of multigrid, this corresponds to homogeneous Dirichlet
+    // constraints for all degrees of freedom on these boundaries.
+    if(this->param.spatial_discretization == SpatialDiscretization::HDIV)
+    {
+      for(auto iter : this->momentum_operator.get_data().bc->symmetry_bc)
+      {
+        dirichlet_boundary_conditions.insert(
+          std::make_pair(iter.first, std::make_shared<dealii::Functions::ZeroFunction<dim>>(dim)));
+      }
+    }
+
     typedef std::map<dealii::types::boundary_id, dealii::ComponentMask> Map_DBC_ComponentMask;
     Map_DBC_ComponentMask                                               dirichlet_bc_component_mask;
 
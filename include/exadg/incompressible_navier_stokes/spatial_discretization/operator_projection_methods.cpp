@@ -204,7 +204,9 @@ template<int dim, typename Number>
 void
 OperatorProjectionMethods<dim, Number>::initialize_solver_pressure_poisson()
 {
-  if(this->param.solver_pressure_poisson == SolverPressurePoisson::CG)
+  if(this->param.solver_pressure_poisson == SolverPressurePoisson::CG ||
+     this->param.solver_pressure_poisson == SolverPressurePoisson::PipelinedCG ||
+     this->param.solver_pressure_poisson == SolverPressurePoisson::FusedCG)
   {
     // setup solver data
     Krylov::SolverDataCG solver_data;
@@ -219,12 +221,33 @@ OperatorProjectionMethods<dim, Number>::initialize_solver_pressure_poisson()
     }
 
     // setup solver
-    pressure_poisson_solver =
-      std::make_shared<Krylov::SolverCG<Poisson::LaplaceOperator<dim, Number, 1>,
-                                        PreconditionerBase<Number>,
-                                        VectorType>>(laplace_operator,
-                                                     *preconditioner_pressure_poisson,
-                                                     solver_data);
+    if(this->param.solver_pressure_poisson == SolverPressurePoisson::CG)
+    {
+      pressure_poisson_solver =
+        std::make_shared<Krylov::SolverCG<Poisson::LaplaceOperator<dim, Number, 1>,
+                                          PreconditionerBase<Number>,
+                                          VectorType>>(laplace_operator,
+                                                       *preconditioner_pressure_poisson,
+                                                       solver_data);
+    }
+    else if(this->param.solver_pressure_poisson == SolverPressurePoisson::FusedCG)
+    {
+      pressure_poisson_solver =
+        std::make_shared<Krylov::SolverFusedCG<Poisson::LaplaceOperator<dim, Number, 1>,
+                                               PreconditionerBase<Number>,
+                                               VectorType>>(laplace_operator,
+                                                            *preconditioner_pressure_poisson,
+                                                            solver_data);
+    }
+    else
+    {
+      pressure_poisson_solver =
+        std::make_shared<Krylov::SolverPipelinedCG<Poisson::LaplaceOperator<dim, Number, 1>,
+                                                   PreconditionerBase<Number>,
+                                                   VectorType>>(laplace_operator,
+                                                                *preconditioner_pressure_poisson,
+                                                                solver_data);
+    }
   }
   else if(this->param.solver_pressure_poisson == SolverPressurePoisson::FGMRES)
   {
@@ -166,6 +166,25 @@ MomentumOperator<dim, Number>::set_scaling_factor_mass_operator(Number const & n
   this->scaling_factor_mass = number;
 }
 
+template<int dim, typename Number>
+Elementwise::TensorProductCoefficients
+MomentumOperator<dim, Number>::get_tensor_product_coefficients() const
+{
+  // the convective term is neglected and a variable viscosity is replaced by the constant one
+  Elementwise::TensorProductCoefficients coefficients;
+
+  if(operator_data.unsteady_problem)
+    coefficients.mass_factor = scaling_factor_mass;
+
+  if(operator_data.viscous_problem)
+  {
+    coefficients.diffusivity = viscous_kernel->get_data().viscosity;
+    coefficients.IP_factor   = viscous_kernel->get_data().IP_factor;
+  }
+
+  return coefficients;
+}
+
 template<int dim, typename Number>
 void
 MomentumOperator<dim, Number>::rhs(VectorType & dst) const
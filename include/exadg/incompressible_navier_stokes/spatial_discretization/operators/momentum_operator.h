@@ -103,6 +103,9 @@ public:
   void
   set_scaling_factor_mass_operator(Number const & number);
 
+  Elementwise::TensorProductCoefficients
+  get_tensor_product_coefficients() const;
+
   /*
    * Interfaces of OperatorBase.
    */
@@ -371,6 +371,22 @@ SpatialOperatorBase<dim, Number>::distribute_dofs()
   pcout << std::flush;
 }
 
+template<int dim, typename Number>
+void
+SpatialOperatorBase<dim, Number>::distribute_dofs_after_coarsening_and_refinement()
+{
+  distribute_dofs();
+
+  // the degree of freedom used to fix the pressure level has changed
+  if(is_pressure_level_undefined())
+  {
+    if(param.adjust_pressure_level == AdjustPressureLevel::ApplyAnalyticalSolutionInPoint)
+    {
+      initialization_pure_dirichlet_bc();
+    }
+  }
+}
+
 template<int dim, typename Number>
 dealii::types::global_dof_index
 SpatialOperatorBase<dim, Number>::get_number_of_dofs() const
@@ -542,8 +558,9 @@ SpatialOperatorBase<dim, Number>::initialize_operators(std::string const & dof_i
     data.solver_block_diagonal = Elementwise::Solver::GMRES;
   else
     data.solver_block_diagonal = Elementwise::Solver::CG;
-  data.preconditioner_block_diagonal = Elementwise::Preconditioner::InverseMassMatrix;
-  data.solver_data_block_diagonal    = param.solver_data_block_diagonal;
+  data.preconditioner_block_diagonal      = param.preconditioner_block_diagonal;
+  data.solver_data_block_diagonal         = param.solver_data_block_diagonal;
+  data.use_mixed_precision_block_diagonal = param.use_mixed_precision_block_diagonal;
 
   momentum_operator.initialize(
     *matrix_free, constraint_dummy, data, viscous_kernel, convective_kernel);
@@ -1651,7 +1668,9 @@ SpatialOperatorBase<dim, Number>::setup_projection_solver()
     }
 
     // solver
-    if(param.solver_projection == SolverProjection::CG)
+    if(param.solver_projection == SolverProjection::CG ||
+       param.solver_projection == SolverProjection::PipelinedCG ||
+       param.solver_projection == SolverProjection::FusedCG)
     {
       // setup solver data
       Krylov::SolverDataCG solver_data;
@@ -1665,9 +1684,24 @@ SpatialOperatorBase<dim, Number>::setup_projection_solver()
       }
 
       // setup solver
-      projection_solver =
-        std::make_shared<Krylov::SolverCG<ProjOperator, PreconditionerBase<Number>, VectorType>>(
+      if(param.solver_projection == SolverProjection::CG)
+      {
+        projection_solver =
+          std::make_shared<Krylov::SolverCG<ProjOperator, PreconditionerBase<Number>, VectorType>>(
+            *projection_operator, *preconditioner_projection, solver_data);
+      }
+      else if(param.solver_projection == SolverProjection::FusedCG)
+      {
+        projection_solver = std::make_shared<
+          Krylov::SolverFusedCG<ProjOperator, PreconditionerBase<Number>, VectorType>>(
           *projection_operator, *preconditioner_projection, solver_data);
+      }
+      else
+      {
+        projection_solver = std::make_shared<
+          Krylov::SolverPipelinedCG<ProjOperator, PreconditionerBase<Number>, VectorType>>(
+          *projection_operator, *preconditioner_projection, solver_data);
+      }
     }
     else if(param.solver_projection == SolverProjection::FGMRES)
     {
@@ -1707,7 +1741,11 @@ template<int dim, typename Number>
 bool
 SpatialOperatorBase<dim, Number>::unsteady_problem_has_to_be_solved() const
 {
-  return (this->param.solver_type == SolverType::Unsteady);
+  // Pseudo-transient continuation requires the (pseudo) time derivative term also for the steady
+  // solver.
+  return (this->param.solver_type == SolverType::Unsteady) or
+         (this->param.solver_type == SolverType::Steady and
+          this->param.pseudo_transient_continuation);
 }
 
 template<int dim, typename Number>
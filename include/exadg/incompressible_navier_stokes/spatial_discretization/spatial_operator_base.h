@@ -406,6 +406,14 @@ public:
   virtual void
   update_after_grid_motion();
 
+  /*
+   * Distributes the degrees of freedom after the triangulation has been changed by adaptive mesh
+   * refinement. The MatrixFree object has to be reinitialized and setup() and setup_solvers() have
+   * to be called again afterwards.
+   */
+  void
+  distribute_dofs_after_coarsening_and_refinement();
+
   /*
    * Sets the grid velocity.
    */
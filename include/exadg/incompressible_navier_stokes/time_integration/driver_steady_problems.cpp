@@ -157,6 +157,20 @@ DriverSteadyProblems<dim, Number>::do_solve(double const time, bool unsteady_pro
     iterations.first += 1;
     std::get<1>(iterations.second) += n_iter;
   }
+  else if(this->param.pseudo_transient_continuation)
+  {
+    auto const iter = solve_pseudo_transient_continuation(time, unsteady_problem);
+
+    if(print_solver_info(time, unsteady_problem) and not(this->is_test))
+      print_solver_info_pseudo_transient(pcout,
+                                         std::get<0>(iter),
+                                         std::get<1>(iter),
+                                         timer.wall_time());
+
+    iterations.first += 1;
+    std::get<0>(iterations.second) += std::get<0>(iter);
+    std::get<1>(iterations.second) += std::get<1>(iter);
+  }
   else // nonlinear problem
   {
     VectorType rhs(solution.block(0));
@@ -181,6 +195,121 @@ DriverSteadyProblems<dim, Number>::do_solve(double const time, bool unsteady_pro
   timer_tree->insert({"DriverSteady", "Solve"}, timer.wall_time());
 }
 
+template<int dim, typename Number>
+std::tuple<unsigned int, unsigned int>
+DriverSteadyProblems<dim, Number>::solve_pseudo_transient_continuation(double const time,
+                                                                       bool unsteady_problem)
+{
+  unsigned int n_steps = 0, n_iter_linear = 0;
+
+  BlockVectorType residual;
+  pde_operator->initialize_block_vector_velocity_pressure(residual);
+
+  VectorType rhs(solution.block(0));
+
+  // residual of the steady problem
+  pde_operator->evaluate_nonlinear_residual_steady(residual, solution, time);
+
+  double norm_r   = residual.l2_norm();
+  double norm_r_0 = norm_r;
+
+  double cfl = this->param.pseudo_transient_cfl_initial;
+
+  // The pseudo time step enters the operator via the mass term. The preconditioner is therefore
+  // updated whenever the pseudo time step has changed by more than this factor since the last
+  // update (and in the first step), also if update_preconditioner_coupled is false.
+  double const factor_update_preconditioner    = 2.0;
+  double       pseudo_time_step_preconditioner = -1.0;
+
+  while(norm_r > this->param.abs_tol_steady && norm_r / norm_r_0 > this->param.rel_tol_steady &&
+        n_steps < this->param.pseudo_transient_max_steps)
+  {
+    double const pseudo_time_step    = calculate_pseudo_time_step(cfl);
+    double const scaling_factor_mass = 1.0 / pseudo_time_step;
+
+    // rhs = 1/dtau * M * u_k + f
+    pde_operator->apply_mass_operator(rhs, solution.block(0));
+    rhs *= scaling_factor_mass;
+    if(this->param.right_hand_side)
+      pde_operator->evaluate_add_body_force_term(rhs, time);
+
+    // one Newton step of the implicit Euler pseudo time step
+    bool const pseudo_time_step_changed =
+      pseudo_time_step_preconditioner <= 0.0 ||
+      pseudo_time_step > factor_update_preconditioner * pseudo_time_step_preconditioner ||
+      pseudo_time_step_preconditioner > factor_update_preconditioner * pseudo_time_step;
+
+    bool const update_preconditioner =
+      pseudo_time_step_changed ||
+      (this->param.update_preconditioner_coupled &&
+       (n_steps % this->param.update_preconditioner_coupled_every_time_steps == 0));
+
+    if(update_preconditioner)
+      pseudo_time_step_preconditioner = pseudo_time_step;
+
+    n_iter_linear += pde_operator->perform_newton_step(
+      solution, rhs, update_preconditioner, time, scaling_factor_mass);
+
+    ++n_steps;
+
+    // switched evolution relaxation (SER)
+    pde_operator->evaluate_nonlinear_residual_steady(residual, solution, time);
+    double const norm_r_new = residual.l2_norm();
+
+    AssertThrow(std::isfinite(norm_r_new),
+                dealii::ExcMessage("Pseudo-transient continuation diverged."));
+
+    cfl    = std::min(cfl * norm_r / norm_r_new, this->param.pseudo_transient_cfl_max);
+    norm_r = norm_r_new;
+
+    if(print_solver_info(time, unsteady_problem) and not(this->is_test))
+    {
+      std::ios_base::fmtflags const flags     = pcout.get_stream().flags();
+      std::streamsize const         precision = pcout.get_stream().precision();
+
+      pcout << "  Pseudo time step " << std::setw(6) << std::right << n_steps
+            << ":  CFL = " << std::scientific << std::setprecision(2) << cfl
+            << ",  |r| / |r_0| = " << norm_r / norm_r_0 << std::endl;
+
+      pcout.get_stream().flags(flags);
+      pcout.get_stream().precision(precision);
+    }
+  }
+
+  AssertThrow(norm_r <= this->param.abs_tol_steady ||
+                norm_r / norm_r_0 <= this->param.rel_tol_steady,
+              dealii::ExcMessage("Pseudo-transient continuation failed to reach steady state. "
+                                 "Maximum number of pseudo time steps exceeded!"));
+
+  return std::tuple<unsigned int, unsigned int>(n_steps, n_iter_linear);
+}
+
+template<int dim, typename Number>
+double
+DriverSteadyProblems<dim, Number>::calculate_pseudo_time_step(double const cfl) const
+{
+  double time_step = std::numeric_limits<double>::max();
+
+  // local CFL criterion evaluated for the current velocity field
+  if(solution.block(0).linfty_norm() > 0.0)
+  {
+    time_step = pde_operator->calculate_time_step_cfl(solution.block(0));
+  }
+  // The velocity field might be zero, e.g., for the initial guess, so that the local CFL criterion
+  // can not be evaluated. The global CFL criterion with the maximum velocity specified by the user
+  // is used in this case.
+  else if(this->param.max_velocity > 0.0)
+  {
+    time_step = pde_operator->calculate_time_step_cfl_global();
+  }
+
+  AssertThrow(time_step < std::numeric_limits<double>::max(),
+              dealii::ExcMessage("Pseudo time step size could not be determined since the "
+                                 "velocity field is zero. Specify the parameter max_velocity."));
+
+  return cfl * time_step;
+}
+
 template<int dim, typename Number>
 bool
 DriverSteadyProblems<dim, Number>::print_solver_info(double const time, bool unsteady_problem) const
@@ -206,9 +335,14 @@ DriverSteadyProblems<dim, Number>::print_iterations() const
   }
   else // nonlinear system of equations in momentum step
   {
-    names = {"Coupled system (nonlinear)",
-             "Coupled system (linear accumulated)",
-             "Coupled system (linear per nonlinear)"};
+    if(this->param.pseudo_transient_continuation)
+      names = {"Coupled system (pseudo time steps)",
+               "Coupled system (linear accumulated)",
+               "Coupled system (linear per pseudo time step)"};
+    else
+      names = {"Coupled system (nonlinear)",
+               "Coupled system (linear accumulated)",
+               "Coupled system (linear per nonlinear)"};
 
     iterations_avg.resize(3);
     iterations_avg[0] =
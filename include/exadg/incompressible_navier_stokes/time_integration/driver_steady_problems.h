@@ -83,6 +83,19 @@ private:
   void
   do_solve(double const time = 0.0, bool unsteady_problem = false);
 
+  /*
+   * Solves the nonlinear steady problem by pseudo-transient continuation and returns the number of
+   * pseudo time steps and the accumulated number of linear iterations.
+   */
+  std::tuple<unsigned int, unsigned int>
+  solve_pseudo_transient_continuation(double const time, bool unsteady_problem);
+
+  /*
+   * Computes the pseudo time step size for a given CFL number based on the local CFL criterion.
+   */
+  double
+  calculate_pseudo_time_step(double const cfl) const;
+
   bool
   print_solver_info(double const time, bool unsteady_problem = false) const;
 
@@ -173,6 +173,94 @@ TimeIntBDF<dim, Number>::advance_one_timestep_partitioned_solve(bool const use_e
   Base::advance_one_timestep_solve();
 }
 
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::prepare_coarsening_and_refinement()
+{
+  std::vector<VectorType const *> velocities, pressures;
+  for(unsigned int i = 0; i < this->order; ++i)
+  {
+    get_velocity(i).update_ghost_values();
+    velocities.push_back(&get_velocity(i));
+
+    get_pressure(i).update_ghost_values();
+    pressures.push_back(&get_pressure(i));
+  }
+
+  solution_transfer_velocity =
+    std::make_shared<dealii::parallel::distributed::SolutionTransfer<dim, VectorType>>(
+      operator_base->get_dof_handler_u());
+  solution_transfer_velocity->prepare_for_coarsening_and_refinement(velocities);
+
+  solution_transfer_pressure =
+    std::make_shared<dealii::parallel::distributed::SolutionTransfer<dim, VectorType>>(
+      operator_base->get_dof_handler_p());
+  solution_transfer_pressure->prepare_for_coarsening_and_refinement(pressures);
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::interpolate_after_coarsening_and_refinement()
+{
+  AssertThrow(solution_transfer_velocity.get() != nullptr and
+                solution_transfer_pressure.get() != nullptr,
+              dealii::ExcMessage("prepare_coarsening_and_refinement() has not been called."));
+
+  this->allocate_vectors();
+
+  // The solution vectors are interpolated into temporary vectors since the derived classes store
+  // velocity and pressure in different data structures, see set_velocity() and set_pressure().
+  std::vector<VectorType> velocities(this->order), pressures(this->order);
+
+  std::vector<VectorType *> velocity_ptrs, pressure_ptrs;
+  for(unsigned int i = 0; i < this->order; ++i)
+  {
+    operator_base->initialize_vector_velocity(velocities[i]);
+    velocity_ptrs.push_back(&velocities[i]);
+
+    operator_base->initialize_vector_pressure(pressures[i]);
+    pressure_ptrs.push_back(&pressures[i]);
+  }
+
+  solution_transfer_velocity->interpolate(velocity_ptrs);
+  solution_transfer_velocity.reset();
+
+  solution_transfer_pressure->interpolate(pressure_ptrs);
+  solution_transfer_pressure.reset();
+
+  for(unsigned int i = 0; i < this->order; ++i)
+  {
+    velocities[i].zero_out_ghost_values();
+    set_velocity(velocities[i], i);
+
+    pressures[i].zero_out_ghost_values();
+    set_pressure(pressures[i], i);
+  }
+
+  update_after_coarsening_and_refinement();
+
+  // the CFL condition changes with the element size
+  if(this->adaptive_time_stepping)
+    this->set_current_time_step_size(recalculate_time_step_size());
+}
+
+template<int dim, typename Number>
+void
+TimeIntBDF<dim, Number>::update_after_coarsening_and_refinement()
+{
+  // the convective term is not transferred but evaluated for the transferred velocities
+  if(this->param.convective_problem() &&
+     this->param.treatment_of_convective_term == TreatmentOfConvectiveTerm::Explicit)
+  {
+    for(unsigned int i = 0; i < vec_convective_term.size(); ++i)
+    {
+      this->operator_base->evaluate_convective_term(vec_convective_term[i],
+                                                    get_velocity(i),
+                                                    this->get_previous_time(i));
+    }
+  }
+}
+
 template<int dim, typename Number>
 void
 TimeIntBDF<dim, Number>::initialize_vec_convective_term()
@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_TIME_INTEGRATION_TIME_INT_BDF_H_
 
 // deal.II
+#include <deal.II/distributed/solution_transfer.h>
 #include <deal.II/lac/la_parallel_vector.h>
 
 // ExaDG
@@ -86,6 +87,19 @@ public:
   void
   advance_one_timestep_partitioned_solve(bool const use_extrapolation);
 
+  /*
+   * Adaptive mesh refinement and repartitioning: The velocity and pressure at previous instants of
+   * time are transferred to the adapted triangulation. prepare_coarsening_and_refinement() has to
+   * be called before the triangulation is changed, interpolate_after_coarsening_and_refinement()
+   * after the degrees of freedom have been distributed and the operator has been set up on the
+   * adapted triangulation.
+   */
+  void
+  prepare_coarsening_and_refinement();
+
+  void
+  interpolate_after_coarsening_and_refinement();
+
   virtual void
   print_iterations() const = 0;
 
@@ -108,6 +122,13 @@ protected:
   void
   prepare_vectors_for_next_timestep() override;
 
+  /*
+   * Adaptive mesh refinement: evaluates those vectors at previous instants of time that are not
+   * transferred to the adapted triangulation, e.g., the convective term.
+   */
+  virtual void
+  update_after_coarsening_and_refinement();
+
   Parameters const & param;
 
   // number of refinement steps, where the time step size is reduced in
@@ -160,6 +181,10 @@ private:
   VectorType              grid_velocity;
   std::vector<VectorType> vec_grid_coordinates;
   VectorType              grid_coordinates_np;
+
+  // adaptive mesh refinement and repartitioning
+  std::shared_ptr<dealii::parallel::distributed::SolutionTransfer<dim, VectorType>>
+    solution_transfer_velocity, solution_transfer_pressure;
 };
 
 } // namespace IncNS
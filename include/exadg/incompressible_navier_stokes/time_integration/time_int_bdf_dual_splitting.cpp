@@ -83,6 +83,17 @@ TimeIntBDFDualSplitting<dim, Number>::setup_derived()
   }
 }
 
+template<int dim, typename Number>
+void
+TimeIntBDFDualSplitting<dim, Number>::update_after_coarsening_and_refinement()
+{
+  Base::update_after_coarsening_and_refinement();
+
+  // the boundary data is not transferred but evaluated at the previous instants of time
+  for(unsigned int i = 0; i < velocity_dbc.size(); ++i)
+    pde_operator->interpolate_velocity_dirichlet_bc(velocity_dbc[i], this->get_previous_time(i));
+}
+
 template<int dim, typename Number>
 void
 TimeIntBDFDualSplitting<dim, Number>::read_restart_vectors(boost::archive::binary_iarchive & ia)
@@ -92,6 +92,17 @@ TimeIntBDFPressureCorrection<dim, Number>::setup_derived()
   }
 }
 
+template<int dim, typename Number>
+void
+TimeIntBDFPressureCorrection<dim, Number>::update_after_coarsening_and_refinement()
+{
+  Base::update_after_coarsening_and_refinement();
+
+  // the boundary data is not transferred but evaluated at the previous instants of time
+  for(unsigned int i = 0; i < pressure_dbc.size(); ++i)
+    pde_operator->interpolate_pressure_dirichlet_bc(pressure_dbc[i], this->get_previous_time(i));
+}
+
 template<int dim, typename Number>
 void
 TimeIntBDFPressureCorrection<dim, Number>::read_restart_vectors(
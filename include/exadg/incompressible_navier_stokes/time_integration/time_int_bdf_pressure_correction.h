@@ -78,6 +78,9 @@ private:
   void
   setup_derived() final;
 
+  void
+  update_after_coarsening_and_refinement() final;
+
   void
   update_time_integrator_constants() final;
 
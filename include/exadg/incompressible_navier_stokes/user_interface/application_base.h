@@ -23,6 +23,7 @@
 #define INCLUDE_EXADG_INCOMPRESSIBLE_NAVIER_STOKES_USER_INTERFACE_APPLICATION_BASE_H_
 
 // deal.II
+#include <deal.II/base/timer.h>
 #include <deal.II/distributed/fully_distributed_tria.h>
 #include <deal.II/distributed/tria.h>
 #include <deal.II/grid/grid_generator.h>
@@ -64,7 +65,8 @@ public:
     : mpi_comm(comm),
       pcout(std::cout, dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0),
       parameter_file(parameter_file),
-      n_subdivisions_1d_hypercube(1)
+      n_subdivisions_1d_hypercube(1),
+      wall_time_create_grid(0.0)
   {
     grid = std::make_shared<Grid<dim>>();
   }
@@ -103,8 +105,10 @@ public:
     param.print(pcout, "List of parameters:");
 
     // grid
+    dealii::Timer timer;
     grid->initialize(param.grid, mpi_comm);
     create_grid();
+    wall_time_create_grid = timer.wall_time();
     print_grid_info(pcout, *grid);
 
     // boundary conditions
@@ -132,6 +136,12 @@ public:
     return grid;
   }
 
+  double
+  get_wall_time_create_grid() const
+  {
+    return wall_time_create_grid;
+  }
+
   std::shared_ptr<BoundaryDescriptor<dim> const>
   get_boundary_descriptor() const
   {
@@ -225,6 +235,9 @@ protected:
 
   OutputParameters output_parameters;
 
+  // wall time of the grid creation (including the partitioning of the triangulation)
+  double wall_time_create_grid;
+
 private:
   virtual void
   set_parameters() = 0;
@@ -343,11 +343,17 @@ enum class QuadratureRuleLinearization
  *
  *  use CG (conjugate gradient) method as default. FGMRES might be necessary
  *  if a Krylov method is used inside the preconditioner (e.g., as multigrid
- *  smoother or as multigrid coarse grid solver)
+ *  smoother or as multigrid coarse grid solver). PipelinedCG hides the latency
+ *  of the global reductions of CG behind the operator and preconditioner
+ *  application and might be beneficial for large numbers of MPI ranks. FusedCG
+ *  performs vector updates and inner products of CG within the operator
+ *  evaluation to reduce memory transfer
  */
 enum class SolverPressurePoisson
 {
   CG,
+  PipelinedCG,
+  FusedCG,
   FGMRES
 };
 
@@ -367,10 +373,14 @@ enum class PreconditionerPressurePoisson
  *  Type of projection solver
  *
  *  - use CG as default
+ *  - PipelinedCG and FusedCG are only available for the globally coupled problem (continuity
+ *    penalty)
  */
 enum class SolverProjection
 {
   CG,
+  PipelinedCG,
+  FusedCG,
   FGMRES
 };
 
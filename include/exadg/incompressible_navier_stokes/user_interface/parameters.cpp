@@ -45,6 +45,7 @@ Parameters::Parameters()
     // ALE
     ale_formulation(false),
     mesh_movement_type(MeshMovementType::Function),
+    mesh_movement_tolerance(0.0),
     neumann_with_variable_normal_vector(false),
 
     // PHYSICAL QUANTITIES
@@ -78,6 +79,10 @@ Parameters::Parameters()
     convergence_criterion_steady_problem(ConvergenceCriterionSteadyProblem::Undefined),
     abs_tol_steady(1.e-20),
     rel_tol_steady(1.e-12),
+    pseudo_transient_continuation(false),
+    pseudo_transient_cfl_initial(1.0),
+    pseudo_transient_cfl_max(1.e8),
+    pseudo_transient_max_steps(1000),
 
     // output of solver information
     solver_info_data(SolverInfoData()),
@@ -98,6 +103,12 @@ Parameters::Parameters()
     degree_u(2),
     degree_p(DegreePressure::MixedOrder),
 
+    // adaptive mesh refinement
+    use_adaptive_mesh_refinement(false),
+    adaptive_mesh_refinement_data(AdaptiveMeshRefinementData()),
+    use_load_balancing(false),
+    load_balancing_data(LoadBalancingData()),
+
     // convective term
     upwind_factor(1.0),
     type_dirichlet_bc_convective(TypeDirichletBCs::Mirror),
@@ -139,6 +150,8 @@ Parameters::Parameters()
     implement_block_diagonal_preconditioner_matrix_free(false),
     use_cell_based_face_loops(false),
     solver_data_block_diagonal(SolverData(1000, 1.e-12, 1.e-2, 1000)),
+    preconditioner_block_diagonal(Elementwise::Preconditioner::InverseMassMatrix),
+    use_mixed_precision_block_diagonal(false),
     quad_rule_linearization(QuadratureRuleLinearization::Overintegration32k),
 
     // PROJECTION METHODS
@@ -214,6 +227,7 @@ Parameters::Parameters()
     update_preconditioner_coupled(false),
     update_preconditioner_coupled_every_newton_iter(1),
     update_preconditioner_coupled_every_time_steps(1),
+    update_preconditioner_coupled_velocity_tolerance(0.0),
 
     // preconditioner velocity/momentum block
     preconditioner_velocity_block(MomentumPreconditioner::InverseMassMatrix),
@@ -277,6 +291,9 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
       dealii::ExcMessage(
         "ALE formulation only implemented for equations that include the convective operator, "
         "e.g., ALE is currently not available for the Stokes equations."));
+
+    AssertThrow(mesh_movement_tolerance >= 0.0,
+                dealii::ExcMessage("mesh_movement_tolerance must not be negative."));
   }
 
   // PHYSICAL QUANTITIES
@@ -307,6 +324,17 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
                   dealii::ExcMessage(
                     "Convective term has to be formulated implicitly when using a steady solver."));
     }
+
+    if(pseudo_transient_continuation)
+    {
+      AssertThrow(nonlinear_problem_has_to_be_solved(),
+                  dealii::ExcMessage(
+                    "Pseudo-transient continuation is only implemented for nonlinear problems."));
+
+      AssertThrow(pseudo_transient_cfl_initial > 0.0 and
+                    pseudo_transient_cfl_max >= pseudo_transient_cfl_initial,
+                  dealii::ExcMessage("Invalid CFL numbers for pseudo-transient continuation."));
+    }
   }
 
   // In case of a steady solver, the parameter temporal_discretization does not have to be
@@ -360,6 +388,48 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
         "Polynomial degree of pressure has to be larger than zero for projection-type methods."));
   }
 
+  if(use_adaptive_mesh_refinement)
+    adaptive_mesh_refinement_data.check();
+
+  if(use_load_balancing)
+    load_balancing_data.check();
+
+  // the triangulation is changed during the time loop
+  if(use_adaptive_mesh_refinement or use_load_balancing)
+  {
+    AssertThrow(solver_type == SolverType::Unsteady,
+                dealii::ExcMessage("Adaptive mesh refinement and repartitioning are only "
+                                   "implemented for the unsteady solver."));
+
+    AssertThrow(spatial_discretization == SpatialDiscretization::L2,
+                dealii::ExcMessage("Adaptive mesh refinement and repartitioning are only "
+                                   "implemented for SpatialDiscretization::L2."));
+
+    AssertThrow(ale_formulation == false,
+                dealii::ExcMessage("Adaptive mesh refinement and repartitioning can not be "
+                                   "combined with the ALE formulation."));
+
+    AssertThrow(grid.triangulation_type == TriangulationType::Distributed,
+                dealii::ExcMessage("Adaptive mesh refinement and repartitioning require "
+                                   "TriangulationType::Distributed."));
+
+    AssertThrow(not(involves_h_multigrid() and
+                    grid.multigrid == MultigridVariant::GlobalCoarsening),
+                dealii::ExcMessage("Adaptive mesh refinement and repartitioning in combination "
+                                   "with h-multigrid require MultigridVariant::LocalSmoothing, "
+                                   "since the coarse triangulations of global coarsening are "
+                                   "created only once."));
+  }
+
+  // MultigridVariant::LocalSmoothing does not support hanging nodes, and the coarse
+  // triangulations of MultigridVariant::GlobalCoarsening are not recreated after refinement
+  if(use_adaptive_mesh_refinement)
+  {
+    AssertThrow(not(involves_multigrid()),
+                dealii::ExcMessage("Adaptive mesh refinement can not be combined with a multigrid "
+                                   "preconditioner. Use a single-level preconditioner instead."));
+  }
+
   AssertThrow(IP_formulation_viscous != InteriorPenaltyFormulation::Undefined,
               dealii::ExcMessage("parameter must be defined"));
 
@@ -398,6 +468,23 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
                 dealii::ExcMessage("Parameter must be defined"));
   }
 
+  // divergence penalty only -> local, elementwise problem solved by elementwise CG
+  if(use_divergence_penalty == true && use_continuity_penalty == false)
+  {
+    AssertThrow(solver_projection == SolverProjection::CG,
+                dealii::ExcMessage("PipelinedCG, FusedCG, and FGMRES are only available for the "
+                                   "globally coupled projection problem (continuity penalty). "
+                                   "Use SolverProjection::CG for the elementwise problem."));
+  }
+
+  // The projection operator only has a separable mass term, for which the fast diagonalization
+  // reduces to the inverse mass matrix.
+  AssertThrow(preconditioner_block_diagonal_projection !=
+                Elementwise::Preconditioner::FastDiagonalization,
+              dealii::ExcMessage("Use Elementwise::Preconditioner::InverseMassMatrix for the "
+                                 "projection operator, which is equivalent to the fast "
+                                 "diagonalization of its mass term."));
+
   if(solver_type == SolverType::Steady)
   {
     if(use_divergence_penalty == true || use_continuity_penalty == true)
@@ -419,9 +506,13 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
     {
       AssertThrow(
         preconditioner_velocity_block == MomentumPreconditioner::None ||
-          preconditioner_velocity_block == MomentumPreconditioner::PointJacobi,
+          preconditioner_velocity_block == MomentumPreconditioner::PointJacobi ||
+          preconditioner_velocity_block == MomentumPreconditioner::Multigrid,
         dealii::ExcMessage(
-          "Use either PointJacobi or None as preconditioner for the momentum block in the case of HDIV - Raviart-Thomas."));
+          "Use either PointJacobi, Multigrid, or None as preconditioner for the momentum block in the case of HDIV - Raviart-Thomas."));
+
+      if(preconditioner_velocity_block == MomentumPreconditioner::Multigrid)
+        check_multigrid_hdiv(multigrid_data_velocity_block);
     }
   }
 
@@ -445,9 +536,13 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
 
       AssertThrow(
         preconditioner_viscous == PreconditionerViscous::None ||
-          preconditioner_viscous == PreconditionerViscous::PointJacobi,
+          preconditioner_viscous == PreconditionerViscous::PointJacobi ||
+          preconditioner_viscous == PreconditionerViscous::Multigrid,
         dealii::ExcMessage(
-          "Use either PointJacobi or None as preconditioner for the viscous step in the case of HDIV - Raviart-Thomas."));
+          "Use either PointJacobi, Multigrid, or None as preconditioner for the viscous step in the case of HDIV - Raviart-Thomas."));
+
+      if(preconditioner_viscous == PreconditionerViscous::Multigrid)
+        check_multigrid_hdiv(multigrid_data_viscous);
     }
 
     AssertThrow(order_extrapolation_pressure_nbc <= order_time_integrator,
@@ -503,6 +598,10 @@ Parameters::check(dealii::ConditionalOStream const & pcout) const
     if(use_scaling_continuity == true)
       AssertThrow(scaling_factor_continuity > 0.0, dealii::ExcMessage("Invalid parameter"));
 
+    AssertThrow(update_preconditioner_coupled_velocity_tolerance >= 0.0,
+                dealii::ExcMessage(
+                  "Invalid parameter update_preconditioner_coupled_velocity_tolerance."));
+
     if(preconditioner_velocity_block == MomentumPreconditioner::Multigrid)
     {
       AssertThrow(multigrid_operator_type_velocity_block != MultigridOperatorType::Undefined,
@@ -661,6 +760,58 @@ Parameters::involves_h_multigrid() const
   return use_global_coarsening;
 }
 
+bool
+Parameters::involves_multigrid() const
+{
+  bool const pressure_block_multigrid =
+    preconditioner_pressure_block == SchurComplementPreconditioner::LaplaceOperator or
+    preconditioner_pressure_block == SchurComplementPreconditioner::CahouetChabard or
+    preconditioner_pressure_block == SchurComplementPreconditioner::PressureConvectionDiffusion;
+
+  bool const penalty_step_multigrid =
+    (use_divergence_penalty or use_continuity_penalty) and
+    preconditioner_projection == PreconditionerProjection::Multigrid;
+
+  // Coupled solver
+  if(solver_type == SolverType::Steady or
+     (solver_type == SolverType::Unsteady and
+      temporal_discretization == TemporalDiscretization::BDFCoupledSolution))
+  {
+    return preconditioner_velocity_block == MomentumPreconditioner::Multigrid or
+           pressure_block_multigrid or
+           (apply_penalty_terms_in_postprocessing_step and penalty_step_multigrid);
+  }
+  else if(temporal_discretization == TemporalDiscretization::BDFDualSplittingScheme or
+          temporal_discretization == TemporalDiscretization::BDFPressureCorrection)
+  {
+    bool use_multigrid =
+      preconditioner_pressure_poisson == PreconditionerPressurePoisson::Multigrid or
+      penalty_step_multigrid;
+
+    if(temporal_discretization == TemporalDiscretization::BDFDualSplittingScheme and
+       viscous_problem())
+    {
+      use_multigrid = use_multigrid or preconditioner_viscous == PreconditionerViscous::Multigrid;
+    }
+
+    if(temporal_discretization == TemporalDiscretization::BDFPressureCorrection and
+       (viscous_problem() or (convective_problem() and
+                              treatment_of_convective_term == TreatmentOfConvectiveTerm::Implicit)))
+    {
+      use_multigrid =
+        use_multigrid or preconditioner_momentum == MomentumPreconditioner::Multigrid;
+    }
+
+    return use_multigrid;
+  }
+  else
+  {
+    AssertThrow(false, dealii::ExcMessage("not implemented."));
+  }
+
+  return false;
+}
+
 
 unsigned int
 Parameters::get_degree_p(unsigned int const degree_u) const
@@ -753,6 +904,8 @@ Parameters::print_parameters_mathematical_model(dealii::ConditionalOStream const
   if(ale_formulation)
   {
     print_parameter(pcout, "Mesh movement type", mesh_movement_type);
+    if(mesh_movement_type != MeshMovementType::Function)
+      print_parameter(pcout, "Mesh movement tolerance", mesh_movement_tolerance);
     print_parameter(pcout, "NBC with variable normal vector", neumann_with_variable_normal_vector);
   }
 }
@@ -859,6 +1012,16 @@ Parameters::print_parameters_spatial_discretization(dealii::ConditionalOStream c
 
   print_parameter(pcout, "Polynomial degree pressure", degree_p);
 
+  print_parameter(pcout, "Adaptive mesh refinement", use_adaptive_mesh_refinement);
+
+  if(use_adaptive_mesh_refinement)
+    adaptive_mesh_refinement_data.print(pcout);
+
+  print_parameter(pcout, "Cost-weighted repartitioning", use_load_balancing);
+
+  if(use_load_balancing)
+    load_balancing_data.print(pcout);
+
   if(this->convective_problem())
   {
     print_parameter(pcout, "Convective term - Upwind factor", upwind_factor);
@@ -957,6 +1120,12 @@ Parameters::print_parameters_numerical_parameters(dealii::ConditionalOStream con
 
   if(implement_block_diagonal_preconditioner_matrix_free)
   {
+    print_parameter(pcout, "Preconditioner block diagonal", preconditioner_block_diagonal);
+
+    print_parameter(pcout,
+                    "Mixed precision block diagonal",
+                    use_mixed_precision_block_diagonal);
+
     solver_data_block_diagonal.print(pcout);
   }
 
@@ -1174,6 +1343,23 @@ Parameters::print_parameters_coupled_solver(dealii::ConditionalOStream const & p
     pcout << std::endl;
   }
 
+  // pseudo-transient continuation
+  if(solver_type == SolverType::Steady and nonlinear_problem_has_to_be_solved())
+  {
+    print_parameter(pcout, "Pseudo-transient continuation", pseudo_transient_continuation);
+
+    if(pseudo_transient_continuation)
+    {
+      print_parameter(pcout, "Initial CFL number", pseudo_transient_cfl_initial);
+      print_parameter(pcout, "Maximum CFL number", pseudo_transient_cfl_max);
+      print_parameter(pcout, "Maximum number of pseudo time steps", pseudo_transient_max_steps);
+      print_parameter(pcout, "Absolute tolerance", abs_tol_steady);
+      print_parameter(pcout, "Relative tolerance", rel_tol_steady);
+    }
+
+    pcout << std::endl;
+  }
+
   // Solver linearized problem
   pcout << "Linear solver:" << std::endl;
 
@@ -1199,6 +1385,13 @@ Parameters::print_parameters_coupled_solver(dealii::ConditionalOStream const & p
     print_parameter(pcout,
                     "Update every time steps",
                     update_preconditioner_coupled_every_time_steps);
+
+    if(nonlinear_problem_has_to_be_solved())
+    {
+      print_parameter(pcout,
+                      "Velocity tolerance for update",
+                      update_preconditioner_coupled_velocity_tolerance);
+    }
   }
 
   pcout << std::endl << "  Velocity/momentum block:" << std::endl;
@@ -1338,5 +1531,35 @@ Parameters::involves_h_multigrid_momentum_step() const
   return use_global_coarsening;
 }
 
+void
+Parameters::check_multigrid_hdiv(MultigridData const & multigrid_data) const
+{
+  AssertThrow(grid.multigrid == MultigridVariant::LocalSmoothing,
+              dealii::ExcMessage("Multigrid for HDIV is only implemented for local smoothing."));
+
+  AssertThrow(not(multigrid_data.involves_c_transfer()),
+              dealii::ExcMessage("Multigrid for HDIV does not support c-transfer. "
+                                 "Use hMG, pMG, hpMG, or phMG instead."));
+
+  // Degrees of freedom are shared between neighboring cells for HDIV so that elementwise
+  // (block-Jacobi) preconditioners are not available.
+  AssertThrow(multigrid_data.smoother_data.preconditioner != PreconditionerSmoother::BlockJacobi,
+              dealii::ExcMessage("Use PointJacobi or None as multigrid smoother preconditioner "
+                                 "in the case of HDIV."));
+
+  // Algebraic multigrid is not suited for H(div)-conforming discretizations and the low-order
+  // refined variant requires FE_Q elements.
+  AssertThrow(multigrid_data.coarse_problem.solver != MultigridCoarseGridSolver::AMG,
+              dealii::ExcMessage("Use Chebyshev, CG, or GMRES as multigrid coarse grid solver in "
+                                 "the case of HDIV."));
+
+  AssertThrow(multigrid_data.coarse_problem.preconditioner ==
+                  MultigridCoarseGridPreconditioner::None or
+                multigrid_data.coarse_problem.preconditioner ==
+                  MultigridCoarseGridPreconditioner::PointJacobi,
+              dealii::ExcMessage("Use PointJacobi or None as multigrid coarse grid "
+                                 "preconditioner in the case of HDIV."));
+}
+
 } // namespace IncNS
 } // namespace ExaDG
@@ -26,8 +26,10 @@
 #include <deal.II/base/conditional_ostream.h>
 
 // ExaDG
+#include <exadg/grid/adaptive_mesh_refinement_data.h>
 #include <exadg/grid/enum_types.h>
 #include <exadg/grid/grid_data.h>
+#include <exadg/grid/load_balancing_data.h>
 #include <exadg/incompressible_navier_stokes/user_interface/enum_types.h>
 #include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
 #include <exadg/solvers_and_preconditioners/newton/newton_solver_data.h>
@@ -65,6 +67,10 @@ public:
   bool
   involves_h_multigrid() const;
 
+  // true if any of the linear solvers uses a multigrid preconditioner (h-, p- or c-transfer)
+  bool
+  involves_multigrid() const;
+
   unsigned int
   get_degree_p(unsigned int const degree_u) const;
 
@@ -127,6 +133,10 @@ private:
   bool
   involves_h_multigrid_momentum_step() const;
 
+  // H(div)-conforming discretization: check that the multigrid setup is supported
+  void
+  check_multigrid_hdiv(MultigridData const & multigrid_data) const;
+
 public:
   /**************************************************************************************/
   /*                                                                                    */
@@ -174,6 +184,12 @@ public:
 
   MeshMovementType mesh_movement_type;
 
+  // Only relevant for mesh movement types solving a PDE for the grid displacement (Poisson,
+  // Elasticity): the mapping and all data structures depending on the geometry are only updated
+  // if the grid displacement has changed by more than this absolute tolerance (maximum norm)
+  // since the last update. The default value of zero updates the mesh in every time step.
+  double mesh_movement_tolerance;
+
   bool neumann_with_variable_normal_vector;
 
   /**************************************************************************************/
@@ -274,7 +290,8 @@ public:
   ConvergenceCriterionSteadyProblem convergence_criterion_steady_problem;
 
   // Pseudo-timestepping for steady-state problems: These tolerances are only relevant
-  // when using an unsteady solver to solve the steady Navier-Stokes equations.
+  // when using an unsteady solver to solve the steady Navier-Stokes equations, or when using
+  // pseudo-transient continuation with the steady solver (option ResidualNavierStokes).
   //
   // option ResidualNavierStokes:
   // - these tolerances refer to the norm of the residual of the steady
@@ -286,6 +303,25 @@ public:
   double abs_tol_steady;
   double rel_tol_steady;
 
+  // Pseudo-transient continuation for the steady solver (solver_type = SolverType::Steady):
+  // Instead of applying Newton's method directly to the steady problem, the steady state is
+  // reached by a sequence of implicit Euler pseudo time steps with a single Newton step per pseudo
+  // time step. The pseudo time step size is computed from the local CFL criterion of the current
+  // velocity field, and the CFL number is adapted according to switched evolution relaxation
+  // (SER), CFL_{k+1} = CFL_k * |r_{k-1}| / |r_k|, so that Newton's method is recovered as the
+  // steady state is approached. The iteration terminates once the norm of the steady residual
+  // satisfies abs_tol_steady or rel_tol_steady.
+  bool pseudo_transient_continuation;
+
+  // CFL number of the first pseudo time step
+  double pseudo_transient_cfl_initial;
+
+  // upper bound for the CFL number of the pseudo time steps
+  double pseudo_transient_cfl_max;
+
+  // maximum number of pseudo time steps
+  unsigned int pseudo_transient_max_steps;
+
   // show solver performance (wall time, number of iterations) every ... timesteps
   SolverInfoData solver_info_data;
 
@@ -316,6 +352,20 @@ public:
   // Polynomial degree of pressure shape functions
   DegreePressure degree_p;
 
+  // adapt the triangulation dynamically during the time loop according to a refinement
+  // indicator evaluated for the current velocity
+  bool use_adaptive_mesh_refinement;
+
+  // description: see declaration of AdaptiveMeshRefinementData
+  AdaptiveMeshRefinementData adaptive_mesh_refinement_data;
+
+  // repartition the triangulation periodically during the time loop such that the modeled cost of
+  // the cells is distributed evenly among the MPI processes
+  bool use_load_balancing;
+
+  // description: see declaration of LoadBalancingData
+  LoadBalancingData load_balancing_data;
+
   // convective term: upwind factor describes the scaling factor in front of the
   // stabilization term (which is strictly dissipative) of the numerical function
   // of the convective term. For the divergence formulation of the convective term with
@@ -443,6 +493,15 @@ public:
   // preconditioning problems without a further benefit in global iteration counts.
   SolverData solver_data_block_diagonal;
 
+  // Elementwise preconditioner of the matrix-free block Jacobi preconditioner of the momentum
+  // operator, see enum declaration.
+  Elementwise::Preconditioner preconditioner_block_diagonal;
+
+  // Store the data of the elementwise preconditioner in single precision, while the elementwise
+  // solver computes residuals in the precision of the operator. This parameter applies to the
+  // momentum operator and is only relevant for Elementwise::Preconditioner::FastDiagonalization.
+  bool use_mixed_precision_block_diagonal;
+
   // Quadrature rule used to integrate the linearized convective term. This parameter is
   // therefore only relevant if linear systems of equations have to be solved involving
   // the convective term. For reasons of computational efficiency, it might be advantageous
@@ -511,7 +570,8 @@ public:
   unsigned int update_preconditioner_projection_every_time_steps;
 
   // description: see enum declaration (only relevant if block diagonal is used as
-  // preconditioner)
+  // preconditioner). FastDiagonalization is not available, since it is equivalent to
+  // InverseMassMatrix for the projection operator.
   Elementwise::Preconditioner preconditioner_block_diagonal_projection;
 
   // solver data for block Jacobi preconditioner (only relevant if elementwise
@@ -646,6 +706,15 @@ public:
   // This variable is only used if update_preconditioner_coupled = true.
   unsigned int update_preconditioner_coupled_every_time_steps;
 
+  // Skip an update of the preconditioner if the relative change of the linearization velocity
+  // since the last update of the preconditioner is below this tolerance, i.e., the preconditioner
+  // is reused as long as the velocity field changes slowly. A value of 0.0 (default) means that the
+  // preconditioner is updated whenever an update is requested. The preconditioner is always updated
+  // if the scaling factor of the mass operator (i.e. the time step size) has changed. This variable
+  // is only used if update_preconditioner_coupled = true, if the convective term is treated
+  // implicitly, and if the mesh is not moving.
+  double update_preconditioner_coupled_velocity_tolerance;
+
   // description: see enum declaration
   MomentumPreconditioner preconditioner_velocity_block;
 
@@ -0,0 +1,60 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_MATRIX_FREE_DOF_RENUMBERING_H_
+#define INCLUDE_EXADG_MATRIX_FREE_DOF_RENUMBERING_H_
+
+// deal.II
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_renumbering.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+namespace ExaDG
+{
+/*
+ * Renumbers the degrees of freedom of dof_handler in the order in which dealii::MatrixFree accesses
+ * them when looping over the cell batches, so that the vector entries of neighboring cell batches
+ * are close in memory (dealii::DoFRenumbering::matrix_free_data_locality). By default, the DoFs
+ * follow the order of the cells in the triangulation, which is a z-order curve for
+ * dealii::parallel::distributed::Triangulation, but not necessarily for other triangulations.
+ *
+ * The renumbering only depends on the DoFHandler, i.e., it does not take the constraints or the
+ * options of the actual dealii::MatrixFree object into account. This ensures that two DoFHandler
+ * objects with the same finite element on the same triangulation, e.g. of a PDE operator and the
+ * finest level of a multigrid preconditioner, end up with the same numbering.
+ */
+template<int dim>
+void
+renumber_dofs_for_data_locality(dealii::DoFHandler<dim> & dof_handler)
+{
+  dealii::AffineConstraints<double> constraints;
+  constraints.close();
+
+  typename dealii::MatrixFree<dim, double>::AdditionalData additional_data;
+  additional_data.tasks_parallel_scheme = dealii::MatrixFree<dim, double>::AdditionalData::none;
+
+  dealii::DoFRenumbering::matrix_free_data_locality(dof_handler, constraints, additional_data);
+}
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_MATRIX_FREE_DOF_RENUMBERING_H_ */
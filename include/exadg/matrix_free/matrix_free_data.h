@@ -30,6 +30,7 @@
 #include <deal.II/matrix_free/matrix_free.h>
 
 // ExaDG
+#include <exadg/grid/grid.h>
 #include <exadg/matrix_free/categorization.h>
 #include <exadg/operators/mapping_flags.h>
 
@@ -47,6 +48,15 @@ public:
     data.tasks_parallel_scheme = dealii::MatrixFree<dim, Number>::AdditionalData::none;
   }
 
+  /**
+   * Constructor initializing the data that depend on the grid, i.e., ghost values are exchanged
+   * via shared memory within a compute node, see GridData::use_shared_memory_communicator.
+   */
+  explicit MatrixFreeData(Grid<dim> const & grid) : MatrixFreeData()
+  {
+    data.communicator_sm = grid.communicator_sm;
+  }
+
   /**
    * Append MatrixFreeData by the needs of (another) pde_operator provided as argument to this
    * function.
@@ -160,6 +160,54 @@ OperatorBase<dim, Number, n_components>::vmult(VectorType & dst, VectorType cons
   this->apply(dst, src);
 }
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::vmult(
+  VectorType &                                                        dst,
+  VectorType const &                                                  src,
+  std::function<void(unsigned int const, unsigned int const)> const & operation_before_loop,
+  std::function<void(unsigned int const, unsigned int const)> const & operation_after_loop) const
+{
+  if(is_dg)
+  {
+    // the loops below do not zero the dst-vector, which is done as part of the operation before
+    // the loop on the respective range of entries
+    auto const before_loop = [&](unsigned int const begin, unsigned int const end) {
+      operation_before_loop(begin, end);
+      std::fill(dst.begin() + begin, dst.begin() + end, Number(0.0));
+    };
+
+    if(evaluate_face_integrals())
+    {
+      matrix_free->loop(&This::cell_loop,
+                        &This::face_loop,
+                        &This::boundary_face_loop_hom_operator,
+                        this,
+                        dst,
+                        src,
+                        before_loop,
+                        operation_after_loop,
+                        this->data.dof_index);
+    }
+    else
+    {
+      matrix_free->cell_loop(
+        &This::cell_loop, this, dst, src, before_loop, operation_after_loop, this->data.dof_index);
+    }
+  }
+  else
+  {
+    // For continuous elements, the constrained degrees of freedom are set after the loop, see
+    // apply(). Hence, the operations can not be interleaved with the loop and are applied on the
+    // whole range of locally owned entries instead.
+    operation_before_loop(0, src.locally_owned_size());
+
+    apply(dst, src);
+
+    operation_after_loop(0, dst.locally_owned_size());
+  }
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::vmult_add(VectorType & dst, VectorType const & src) const
@@ -313,6 +361,41 @@ OperatorBase<dim, Number, n_components>::apply_add(VectorType & dst, VectorType
   }
 }
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::apply_batched(BlockVectorType &       dst,
+                                                       BlockVectorType const & src) const
+{
+  AssertThrow(dst.n_blocks() == src.n_blocks(),
+              dealii::ExcMessage("Block vectors dst and src need to have the same number of "
+                                 "blocks."));
+
+  if(is_dg and evaluate_face_integrals())
+  {
+    matrix_free->loop(&This::cell_loop_batched,
+                      &This::face_loop_batched,
+                      &This::boundary_face_loop_hom_operator_batched,
+                      this,
+                      dst,
+                      src,
+                      true);
+  }
+  else
+  {
+    matrix_free->cell_loop(&This::cell_loop_batched, this, dst, src, true);
+  }
+
+  // see function apply() for the treatment of constrained degrees of freedom
+  if(not(is_dg))
+  {
+    for(unsigned int b = 0; b < dst.n_blocks(); ++b)
+      for(unsigned int const constrained_index :
+          matrix_free->get_constrained_dofs(this->data.dof_index))
+        dst.block(b).local_element(constrained_index) =
+          src.block(b).local_element(constrained_index);
+  }
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::rhs(VectorType & rhs) const
@@ -559,6 +642,22 @@ OperatorBase<dim, Number, n_components>::initialize_block_diagonal_preconditione
     elementwise_preconditioner =
       std::make_shared<INVERSE_MASS>(get_matrix_free(), get_dof_index(), get_quad_index());
   }
+  else if(data.preconditioner_block_diagonal == Elementwise::Preconditioner::FastDiagonalization)
+  {
+    // the eigendecompositions are computed in update_block_diagonal_preconditioner()
+    if(data.use_mixed_precision_block_diagonal)
+    {
+      elementwise_preconditioner =
+        std::make_shared<ELEMENTWISE_FAST_DIAGONALIZATION_MIXED_PRECISION>(get_matrix_free(),
+                                                                           get_dof_index(),
+                                                                           get_quad_index());
+    }
+    else
+    {
+      elementwise_preconditioner = std::make_shared<ELEMENTWISE_FAST_DIAGONALIZATION>(
+        get_matrix_free(), get_dof_index(), get_quad_index());
+    }
+  }
   else
   {
     AssertThrow(false, dealii::ExcMessage("Not implemented."));
@@ -635,6 +734,17 @@ OperatorBase<dim, Number, n_components>::apply_add_block_diagonal_elementwise(
   }
 }
 
+template<int dim, typename Number, int n_components>
+Elementwise::TensorProductCoefficients
+OperatorBase<dim, Number, n_components>::get_tensor_product_coefficients() const
+{
+  AssertThrow(false,
+              dealii::ExcMessage("The fast diagonalization preconditioner is not implemented for "
+                                 "this operator."));
+
+  return Elementwise::TensorProductCoefficients();
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::update_block_diagonal_preconditioner() const
@@ -663,9 +773,27 @@ OperatorBase<dim, Number, n_components>::update_block_diagonal_preconditioner()
 
   // update
 
-  // For the matrix-free variant there is nothing to do.
+  // For the matrix-free variant, only the fast diagonalization preconditioner depends on the
+  // current coefficients of the operator.
   // For the matrix-based variant we have to recompute the block matrices.
-  if(!data.implement_block_diagonal_preconditioner_matrix_free)
+  if(data.implement_block_diagonal_preconditioner_matrix_free)
+  {
+    if(data.preconditioner_block_diagonal == Elementwise::Preconditioner::FastDiagonalization)
+    {
+      if(data.use_mixed_precision_block_diagonal)
+      {
+        std::dynamic_pointer_cast<ELEMENTWISE_FAST_DIAGONALIZATION_MIXED_PRECISION>(
+          elementwise_preconditioner)
+          ->update(get_tensor_product_coefficients());
+      }
+      else
+      {
+        std::dynamic_pointer_cast<ELEMENTWISE_FAST_DIAGONALIZATION>(elementwise_preconditioner)
+          ->update(get_tensor_product_coefficients());
+      }
+    }
+  }
+  else
   {
     // clear matrices
     initialize_block_jacobi_matrices_with_zero(matrices);
@@ -771,6 +899,8 @@ void
 OperatorBase<dim, Number, n_components>::internal_calculate_system_matrix(
   SparseMatrix & system_matrix) const
 {
+  compute_unit_vector_evaluations();
+
   // assemble matrix locally on each process
   if(evaluate_face_integrals() && is_dg)
   {
@@ -967,6 +1097,119 @@ OperatorBase<dim, Number, n_components>::create_standard_basis(unsigned int
     integrator_2.begin_dof_values()[i] = dealii::make_vectorized_array<Number>(0.);
 }
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::evaluate_zero_dof_values(IntegratorFace & integrator,
+                                                                  bool const first_call) const
+{
+  dealii::EvaluationFlags::EvaluationFlags const flags = integrator_flags.face_evaluate;
+
+  // Evaluating a vector of zeros results in zero values and gradients in the quadrature points,
+  // so that the sum-factorization kernels can be skipped. Note that the quadrature point data
+  // needs to be reset for every trial function, since it is overwritten by the submit-functions
+  // of the face integral. The first call per face evaluates as usual, which also sets the
+  // internal state of the integrator.
+  if(first_call or (flags & dealii::EvaluationFlags::hessians))
+  {
+    integrator.evaluate(flags);
+  }
+  else
+  {
+    dealii::VectorizedArray<Number> const zero = dealii::make_vectorized_array<Number>(0.);
+
+    if(flags & dealii::EvaluationFlags::values)
+      std::fill_n(integrator.begin_values(), n_components * integrator.n_q_points, zero);
+
+    if(flags & dealii::EvaluationFlags::gradients)
+      std::fill_n(integrator.begin_gradients(), n_components * dim * integrator.n_q_points, zero);
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::compute_unit_vector_evaluations() const
+{
+  unit_vector_evaluations.clear();
+
+  dealii::EvaluationFlags::EvaluationFlags const flags = integrator_flags.cell_evaluate;
+
+  // only values and gradients are precomputed, and there is nothing to do without locally owned
+  // cells
+  if(!(flags & (dealii::EvaluationFlags::values | dealii::EvaluationFlags::gradients)) ||
+     (flags & dealii::EvaluationFlags::hessians) || matrix_free->n_cell_batches() == 0)
+    return;
+
+  // the data of one component are reused for all components, which requires the same shape
+  // functions for all components. This is not the case for non-primitive elements such as
+  // H(div)-conforming elements, for which the unit vectors are evaluated on each cell.
+  dealii::FiniteElement<dim> const & fe =
+    matrix_free->get_dof_handler(this->data.dof_index).get_fe();
+  if(not(fe.is_primitive()) || fe.n_base_elements() != 1)
+    return;
+
+  integrator->reinit(0);
+
+  unsigned int const dofs_per_component = integrator->dofs_per_component;
+  unsigned int const n_q_points         = integrator->n_q_points;
+
+  unit_vector_evaluations.resize(dofs_per_component * (1 + dim) * n_q_points);
+
+  // the data are identical for all vectorization lanes and all components
+  for(unsigned int j = 0; j < dofs_per_component; ++j)
+  {
+    this->create_standard_basis(j, *integrator);
+
+    integrator->evaluate(flags);
+
+    Number * data = &unit_vector_evaluations[j * (1 + dim) * n_q_points];
+
+    if(flags & dealii::EvaluationFlags::values)
+      for(unsigned int q = 0; q < n_q_points; ++q)
+        data[q] = integrator->begin_values()[q][0];
+
+    if(flags & dealii::EvaluationFlags::gradients)
+      for(unsigned int d = 0; d < dim; ++d)
+        for(unsigned int q = 0; q < n_q_points; ++q)
+          data[(1 + d) * n_q_points + q] = integrator->begin_gradients()[d * n_q_points + q][0];
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::fill_unit_vector_evaluation(
+  unsigned int const j,
+  IntegratorCell &   integrator) const
+{
+  dealii::EvaluationFlags::EvaluationFlags const flags = integrator_flags.cell_evaluate;
+
+  unsigned int const n_q_points = integrator.n_q_points;
+
+  // unit vector j is non-zero in a single component only
+  unsigned int const component = j / integrator.dofs_per_component;
+
+  Number const * data =
+    &unit_vector_evaluations[(j % integrator.dofs_per_component) * (1 + dim) * n_q_points];
+
+  dealii::VectorizedArray<Number> const zero = dealii::make_vectorized_array<Number>(0.);
+
+  if(flags & dealii::EvaluationFlags::values)
+  {
+    dealii::VectorizedArray<Number> * values = integrator.begin_values();
+    std::fill_n(values, n_components * n_q_points, zero);
+    for(unsigned int q = 0; q < n_q_points; ++q)
+      values[component * n_q_points + q] = data[q];
+  }
+
+  if(flags & dealii::EvaluationFlags::gradients)
+  {
+    dealii::VectorizedArray<Number> * gradients = integrator.begin_gradients();
+    std::fill_n(gradients, n_components * dim * n_q_points, zero);
+    for(unsigned int d = 0; d < dim; ++d)
+      for(unsigned int q = 0; q < n_q_points; ++q)
+        gradients[(component * dim + d) * n_q_points + q] = data[(1 + d) * n_q_points + q];
+  }
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::cell_loop_dbc(
@@ -1059,6 +1302,83 @@ OperatorBase<dim, Number, n_components>::boundary_face_loop_hom_operator(
   }
 }
 
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::cell_loop_batched(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  BlockVectorType &                       dst,
+  BlockVectorType const &                 src,
+  Range const &                           range) const
+{
+  (void)matrix_free;
+
+  for(auto cell = range.first; cell < range.second; ++cell)
+  {
+    this->reinit_cell(cell);
+
+    for(unsigned int b = 0; b < src.n_blocks(); ++b)
+    {
+      integrator->gather_evaluate(src.block(b), integrator_flags.cell_evaluate);
+
+      this->do_cell_integral(*integrator);
+
+      integrator->integrate_scatter(integrator_flags.cell_integrate, dst.block(b));
+    }
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::face_loop_batched(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  BlockVectorType &                       dst,
+  BlockVectorType const &                 src,
+  Range const &                           range) const
+{
+  (void)matrix_free;
+
+  for(auto face = range.first; face < range.second; ++face)
+  {
+    this->reinit_face(face);
+
+    for(unsigned int b = 0; b < src.n_blocks(); ++b)
+    {
+      integrator_m->gather_evaluate(src.block(b), integrator_flags.face_evaluate);
+      integrator_p->gather_evaluate(src.block(b), integrator_flags.face_evaluate);
+
+      this->do_face_integral(*integrator_m, *integrator_p);
+
+      integrator_m->integrate_scatter(integrator_flags.face_integrate, dst.block(b));
+      integrator_p->integrate_scatter(integrator_flags.face_integrate, dst.block(b));
+    }
+  }
+}
+
+template<int dim, typename Number, int n_components>
+void
+OperatorBase<dim, Number, n_components>::boundary_face_loop_hom_operator_batched(
+  dealii::MatrixFree<dim, Number> const & matrix_free,
+  BlockVectorType &                       dst,
+  BlockVectorType const &                 src,
+  Range const &                           range) const
+{
+  for(unsigned int face = range.first; face < range.second; face++)
+  {
+    this->reinit_boundary_face(face);
+
+    for(unsigned int b = 0; b < src.n_blocks(); ++b)
+    {
+      integrator_m->gather_evaluate(src.block(b), integrator_flags.face_evaluate);
+
+      do_boundary_integral(*integrator_m,
+                           OperatorType::homogeneous,
+                           matrix_free.get_boundary_id(face));
+
+      integrator_m->integrate_scatter(integrator_flags.face_integrate, dst.block(b));
+    }
+  }
+}
+
 template<int dim, typename Number, int n_components>
 void
 OperatorBase<dim, Number, n_components>::boundary_face_loop_inhom_operator(
@@ -1658,23 +1978,37 @@ OperatorBase<dim, Number, n_components>::cell_loop_calculate_system_matrix(
 
   unsigned int const dofs_per_cell = integrator->dofs_per_cell;
 
+  // create a temporal full matrix for the local element matrix of each ...
+  // cell of each macro cell and ...
+  FullMatrix_ matrices[vectorization_length];
+  // set their size
+  std::fill_n(matrices, vectorization_length, FullMatrix_(dofs_per_cell, dofs_per_cell));
+
+  std::vector<dealii::types::global_dof_index> dof_indices(dofs_per_cell);
+  std::vector<dealii::types::global_dof_index> dof_indices_unsorted(dofs_per_cell);
+
   for(auto cell = range.first; cell < range.second; ++cell)
   {
     unsigned int const n_filled_lanes = matrix_free.n_active_entries_per_cell_batch(cell);
 
-    // create a temporal full matrix for the local element matrix of each ...
-    // cell of each macro cell and ...
-    FullMatrix_ matrices[vectorization_length];
-    // set their size
-    std::fill_n(matrices, vectorization_length, FullMatrix_(dofs_per_cell, dofs_per_cell));
-
     this->reinit_cell(cell);
 
     for(unsigned int j = 0; j < dofs_per_cell; ++j)
     {
-      this->create_standard_basis(j, *integrator);
+      // Only the first column per cell is evaluated with the sum-factorization kernels, which also
+      // sets the internal state of the integrator. The remaining columns copy the precomputed
+      // unit-vector evaluations, so that only the quadrature-point operation and the integration
+      // remain per column.
+      if(j == 0 || unit_vector_evaluations.empty())
+      {
+        this->create_standard_basis(j, *integrator);
 
-      integrator->evaluate(integrator_flags.cell_evaluate);
+        integrator->evaluate(integrator_flags.cell_evaluate);
+      }
+      else
+      {
+        this->fill_unit_vector_evaluation(j, *integrator);
+      }
 
       this->do_cell_integral(*integrator);
 
@@ -1690,20 +2024,26 @@ OperatorBase<dim, Number, n_components>::cell_loop_calculate_system_matrix(
     {
       auto cell_v = matrix_free.get_cell_iterator(cell, v);
 
-      std::vector<dealii::types::global_dof_index> dof_indices(dofs_per_cell);
-      if(is_mg)
-        cell_v->get_mg_dof_indices(dof_indices);
+      if(is_dg)
+      {
+        if(is_mg)
+          cell_v->get_mg_dof_indices(dof_indices);
+        else
+          cell_v->get_dof_indices(dof_indices);
+      }
       else
-        cell_v->get_dof_indices(dof_indices);
-
-      if(!is_dg)
       {
+        if(is_mg)
+          cell_v->get_mg_dof_indices(dof_indices_unsorted);
+        else
+          cell_v->get_dof_indices(dof_indices_unsorted);
+
         // in the case of CG: shape functions are not ordered lexicographically
         // see (https://www.dealii.org/8.5.1/doxygen/deal.II/classFE__Q.html)
         // so we have to fix the order
-        auto temp = dof_indices;
         for(unsigned int j = 0; j < dof_indices.size(); j++)
-          dof_indices[j] = temp[matrix_free.get_shape_info().lexicographic_numbering[j]];
+          dof_indices[j] =
+            dof_indices_unsorted[matrix_free.get_shape_info().lexicographic_numbering[j]];
       }
 
       // choose the version of distribute_local_to_global with a single
@@ -1745,6 +2085,9 @@ OperatorBase<dim, Number, n_components>::face_loop_calculate_system_matrix(
   FullMatrix_ matrices_p[vectorization_length];
   std::fill_n(matrices_p, vectorization_length, FullMatrix_(dofs_per_cell, dofs_per_cell));
 
+  std::vector<dealii::types::global_dof_index> dof_indices_m(dofs_per_cell);
+  std::vector<dealii::types::global_dof_index> dof_indices_p(dofs_per_cell);
+
   for(auto face = range.first; face < range.second; ++face)
   {
     // determine number of filled vector lanes
@@ -1760,7 +2103,7 @@ OperatorBase<dim, Number, n_components>::face_loop_calculate_system_matrix(
       this->create_standard_basis(j, *integrator_m, *integrator_p);
 
       integrator_m->evaluate(integrator_flags.face_evaluate);
-      integrator_p->evaluate(integrator_flags.face_evaluate);
+      this->evaluate_zero_dof_values(*integrator_p, j == 0);
 
       this->do_face_integral(*integrator_m, *integrator_p);
 
@@ -1790,8 +2133,6 @@ OperatorBase<dim, Number, n_components>::face_loop_calculate_system_matrix(
                                                   cell_number_p % vectorization_length);
 
       // get position in global matrix
-      std::vector<dealii::types::global_dof_index> dof_indices_m(dofs_per_cell);
-      std::vector<dealii::types::global_dof_index> dof_indices_p(dofs_per_cell);
       if(is_mg)
       {
         cell_m->get_mg_dof_indices(dof_indices_m);
@@ -1819,7 +2160,7 @@ OperatorBase<dim, Number, n_components>::face_loop_calculate_system_matrix(
       // clear dof values of second dealii::FEFaceEvaluation
       this->create_standard_basis(j, *integrator_p, *integrator_m);
 
-      integrator_m->evaluate(integrator_flags.face_evaluate);
+      this->evaluate_zero_dof_values(*integrator_m, j == 0);
       integrator_p->evaluate(integrator_flags.face_evaluate);
 
       this->do_face_integral(*integrator_m, *integrator_p);
@@ -1850,8 +2191,6 @@ OperatorBase<dim, Number, n_components>::face_loop_calculate_system_matrix(
                                                   cell_number_p % vectorization_length);
 
       // get position in global matrix
-      std::vector<dealii::types::global_dof_index> dof_indices_m(dofs_per_cell);
-      std::vector<dealii::types::global_dof_index> dof_indices_p(dofs_per_cell);
       if(is_mg)
       {
         cell_m->get_mg_dof_indices(dof_indices_m);
@@ -1887,14 +2226,16 @@ OperatorBase<dim, Number, n_components>::boundary_face_loop_calculate_system_mat
 
   unsigned int const dofs_per_cell = integrator_m->dofs_per_cell;
 
+  // create temporary matrices for local blocks
+  FullMatrix_ matrices[vectorization_length];
+  std::fill_n(matrices, vectorization_length, FullMatrix_(dofs_per_cell, dofs_per_cell));
+
+  std::vector<dealii::types::global_dof_index> dof_indices(dofs_per_cell);
+
   for(auto face = range.first; face < range.second; ++face)
   {
     unsigned int const n_filled_lanes = matrix_free.n_active_entries_per_face_batch(face);
 
-    // create temporary matrices for local blocks
-    FullMatrix_ matrices[vectorization_length];
-    std::fill_n(matrices, vectorization_length, FullMatrix_(dofs_per_cell, dofs_per_cell));
-
     this->reinit_boundary_face(face);
 
     auto bid = matrix_free.get_boundary_id(face);
@@ -1922,7 +2263,6 @@ OperatorBase<dim, Number, n_components>::boundary_face_loop_calculate_system_mat
       auto cell_v = matrix_free.get_cell_iterator(cell_number / vectorization_length,
                                                   cell_number % vectorization_length);
 
-      std::vector<dealii::types::global_dof_index> dof_indices(dofs_per_cell);
       if(is_mg)
         cell_v->get_mg_dof_indices(dof_indices);
       else
@@ -27,6 +27,7 @@
 #include <deal.II/dofs/dof_handler.h>
 #include <deal.II/lac/affine_constraints.h>
 #include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/la_parallel_block_vector.h>
 #include <deal.II/lac/lapack_full_matrix.h>
 #ifdef DEAL_II_WITH_TRILINOS
 #  include <deal.II/lac/trilinos_sparse_matrix.h>
@@ -64,7 +65,8 @@ struct OperatorBaseData
       implement_block_diagonal_preconditioner_matrix_free(false),
       solver_block_diagonal(Elementwise::Solver::GMRES),
       preconditioner_block_diagonal(Elementwise::Preconditioner::InverseMassMatrix),
-      solver_data_block_diagonal(SolverData(1000, 1.e-12, 1.e-2, 1000))
+      solver_data_block_diagonal(SolverData(1000, 1.e-12, 1.e-2, 1000)),
+      use_mixed_precision_block_diagonal(false)
   {
   }
 
@@ -83,6 +85,10 @@ struct OperatorBaseData
   Elementwise::Solver         solver_block_diagonal;
   Elementwise::Preconditioner preconditioner_block_diagonal;
   SolverData                  solver_data_block_diagonal;
+
+  // store the data of the elementwise preconditioner in single precision (only relevant for
+  // Elementwise::Preconditioner::FastDiagonalization)
+  bool use_mixed_precision_block_diagonal;
 };
 
 template<int dim, typename Number, int n_components = 1>
@@ -91,10 +97,11 @@ class OperatorBase : public dealii::Subscriptor
 public:
   typedef OperatorBase<dim, Number, n_components> This;
 
-  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
-  typedef std::pair<unsigned int, unsigned int>              Range;
-  typedef CellIntegrator<dim, n_components, Number>          IntegratorCell;
-  typedef FaceIntegrator<dim, n_components, Number>          IntegratorFace;
+  typedef dealii::LinearAlgebra::distributed::Vector<Number>      VectorType;
+  typedef dealii::LinearAlgebra::distributed::BlockVector<Number> BlockVectorType;
+  typedef std::pair<unsigned int, unsigned int>                   Range;
+  typedef CellIntegrator<dim, n_components, Number>               IntegratorCell;
+  typedef FaceIntegrator<dim, n_components, Number>               IntegratorFace;
 
   static unsigned int const vectorization_length = dealii::VectorizedArray<Number>::size();
 
@@ -142,6 +149,20 @@ public:
   void
   vmult(VectorType & dst, VectorType const & src) const;
 
+  /*
+   * Matrix-vector product dst = A * src with hooks that are forwarded to the MatrixFree loop:
+   * operation_before_loop(begin, end) is called on the range [begin, end) of locally owned
+   * entries before the first cell (or face) touches these entries, and operation_after_loop(begin,
+   * end) after the last cell (or face) has written into these entries. This allows iterative
+   * solvers to perform vector updates and inner products while the data is still in cache.
+   */
+  void
+  vmult(VectorType &                                                        dst,
+        VectorType const &                                                  src,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_before_loop,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_after_loop)
+    const;
+
   void
   vmult_add(VectorType & dst, VectorType const & src) const;
 
@@ -222,6 +243,16 @@ public:
   void
   apply_add(VectorType & dst, VectorType const & src) const;
 
+  /*
+   * Batched version of apply(): the homogeneous operator is applied to all blocks of src, where
+   * every block is a vector of this operator's dof_index (e.g., several scalar fields sharing
+   * mesh, polynomial degree, and operator coefficients). Every cell and face is visited only once
+   * for all blocks, i.e., the integrators are reinitialized once and the geometry data loaded for
+   * the first block is still in cache for the remaining blocks.
+   */
+  void
+  apply_batched(BlockVectorType & dst, BlockVectorType const & src) const;
+
   /*
    * evaluate inhomogeneous parts of operator related to inhomogeneous boundary face integrals.
    * Operations of this type are called rhs_...() since these functions are called to calculate the
@@ -290,6 +321,14 @@ public:
                                        dealii::VectorizedArray<Number> const * const src,
                                        unsigned int const problem_size) const;
 
+  /*
+   * Coefficients of a separable approximation of the cell-local blocks, required by the fast
+   * diagonalization variant of the matrix-free block Jacobi preconditioner. Operators supporting
+   * this preconditioner have to override this function.
+   */
+  virtual Elementwise::TensorProductCoefficients
+  get_tensor_product_coefficients() const;
+
 protected:
   void
   reinit(dealii::MatrixFree<dim, Number> const &   matrix_free,
@@ -396,6 +435,11 @@ protected:
     IterativeSolver<dim, n_components, Number, ELEMENTWISE_OPERATOR, ELEMENTWISE_PRECONDITIONER>
       ELEMENTWISE_SOLVER;
 
+  typedef Elementwise::FastDiagonalizationPreconditioner<dim, n_components, Number, Number>
+    ELEMENTWISE_FAST_DIAGONALIZATION;
+  typedef Elementwise::FastDiagonalizationPreconditioner<dim, n_components, Number, float>
+    ELEMENTWISE_FAST_DIAGONALIZATION_MIXED_PRECISION;
+
   mutable std::shared_ptr<ELEMENTWISE_OPERATOR>       elementwise_operator;
   mutable std::shared_ptr<ELEMENTWISE_PRECONDITIONER> elementwise_preconditioner;
   mutable std::shared_ptr<ELEMENTWISE_SOLVER>         elementwise_solver;
@@ -419,6 +463,26 @@ private:
                         IntegratorFace & integrator_1,
                         IntegratorFace & integrator_2) const;
 
+  /*
+   * Evaluates the dof values of a face integrator that are known to be zero (as created by the
+   * function create_standard_basis() for the neighbor) in a cheaper way.
+   */
+  void
+  evaluate_zero_dof_values(IntegratorFace & integrator, bool const first_call) const;
+
+  /*
+   * The evaluation of a unit vector in the quadrature points (values and gradients in reference
+   * coordinates) does not depend on the cell. These data are therefore computed once for the
+   * shape functions of a single component before assembling the system matrix, and the
+   * evaluation of the unit vectors is replaced by copying the precomputed data into the
+   * integrator.
+   */
+  void
+  compute_unit_vector_evaluations() const;
+
+  void
+  fill_unit_vector_evaluation(unsigned int const j, IntegratorCell & integrator) const;
+
   /*
    * This function applies Dirichlet BCs for continuous Galerkin discretizations.
    */
@@ -446,6 +510,28 @@ private:
             VectorType const &                      src,
             Range const &                           range) const;
 
+  /*
+   * Batched versions of cell_loop(), face_loop(), and boundary_face_loop_hom_operator() looping
+   * over all blocks of a block vector within the loop over cells/faces.
+   */
+  void
+  cell_loop_batched(dealii::MatrixFree<dim, Number> const & matrix_free,
+                    BlockVectorType &                       dst,
+                    BlockVectorType const &                 src,
+                    Range const &                           range) const;
+
+  void
+  face_loop_batched(dealii::MatrixFree<dim, Number> const & matrix_free,
+                    BlockVectorType &                       dst,
+                    BlockVectorType const &                 src,
+                    Range const &                           range) const;
+
+  void
+  boundary_face_loop_hom_operator_batched(dealii::MatrixFree<dim, Number> const & matrix_free,
+                                          BlockVectorType &                       dst,
+                                          BlockVectorType const &                 src,
+                                          Range const &                           range) const;
+
   /*
    * The following functions loop over all boundary faces and calculate boundary face integrals.
    * Depending on the operator type, we distinguish between boundary face integrals of type
@@ -632,6 +718,13 @@ private:
    */
   mutable std::vector<dealii::LAPACKFullMatrix<Number>> matrices;
 
+  /*
+   * Values and reference-cell gradients of the shape functions of a single component in the
+   * quadrature points, see compute_unit_vector_evaluations(). This vector is empty if the cell
+   * integrals can not be assembled this way, e.g., for non-primitive elements.
+   */
+  mutable std::vector<Number> unit_vector_evaluations;
+
   /*
    * We want to initialize the block diagonal preconditioner (block diagonal matrices or elementwise
    * iterative solvers in case of matrix-free implementation) only once, so we store the status of
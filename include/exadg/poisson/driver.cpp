@@ -63,6 +63,7 @@ Driver<dim, Number>::setup()
   pcout << std::endl << "Setting up Poisson solver:" << std::endl;
 
   application->setup();
+  timer_tree.insert({"Poisson", "Setup", "Create grid"}, application->get_wall_time_create_grid());
 
   poisson->setup(application, mpi_comm, is_throughput_study);
 
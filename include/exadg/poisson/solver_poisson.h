@@ -48,7 +48,7 @@ public:
                                                             "Poisson",
                                                             mpi_comm);
 
-    matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>();
+    matrix_free_data = std::make_shared<MatrixFreeData<dim, Number>>(*application->get_grid());
     matrix_free_data->append(pde_operator);
 
     matrix_free = std::make_shared<dealii::MatrixFree<dim, Number>>();
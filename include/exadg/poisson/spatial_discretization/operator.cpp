@@ -32,6 +32,7 @@
 
 // ExaDG
 #include <exadg/grid/grid_utilities.h>
+#include <exadg/matrix_free/dof_renumbering.h>
 #include <exadg/poisson/preconditioners/multigrid_preconditioner.h>
 #include <exadg/poisson/spatial_discretization/operator.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/block_jacobi_preconditioner.h>
@@ -133,6 +134,9 @@ Operator<dim, n_components, Number>::distribute_dofs()
 
   dof_handler.distribute_dofs(*fe);
 
+  if(param.renumber_dofs_for_data_locality)
+    renumber_dofs_for_data_locality(dof_handler);
+
   // Affine constraints are only relevant for continuous Galerin discretization.
   // The AffineConstraints object is used to initialize MatrixFree. Here, we apply homogeneous
   // boundary conditions as needed by vmult() in iterative solvers for linear systems of equations,
@@ -357,6 +361,9 @@ Operator<dim, n_components, Number>::setup_solver()
     MultigridData mg_data;
     mg_data = param.multigrid_data;
 
+    // the finest multigrid level has to use the same DoF numbering as the PDE operator
+    mg_data.renumber_dofs_for_data_locality = param.renumber_dofs_for_data_locality;
+
     typedef MultigridPreconditioner<dim, Number, n_components> Multigrid;
 
     preconditioner = std::make_shared<Multigrid>(this->mpi_comm);
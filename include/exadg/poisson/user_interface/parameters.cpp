@@ -45,7 +45,8 @@ Parameters::Parameters()
     compute_performance_metrics(false),
     preconditioner(Preconditioner::Undefined),
     multigrid_data(MultigridData()),
-    enable_cell_based_face_loops(false)
+    enable_cell_based_face_loops(false),
+    renumber_dofs_for_data_locality(false)
 {
 }
 
@@ -66,6 +67,21 @@ Parameters::check() const
   AssertThrow(solver != Solver::Undefined, dealii::ExcMessage("parameter must be defined."));
   AssertThrow(preconditioner != Preconditioner::Undefined,
               dealii::ExcMessage("parameter must be defined."));
+
+  // NUMERICAL PARAMETERS
+  if(renumber_dofs_for_data_locality)
+  {
+    AssertThrow(grid.element_type == ElementType::Hypercube,
+                dealii::ExcMessage("Renumbering of DoFs for data locality is only implemented for "
+                                   "ElementType::Hypercube."));
+
+    if(preconditioner == Preconditioner::Multigrid)
+    {
+      AssertThrow(grid.multigrid == MultigridVariant::GlobalCoarsening,
+                  dealii::ExcMessage("Renumbering of DoFs for data locality is only implemented "
+                                     "for MultigridVariant::GlobalCoarsening."));
+    }
+  }
 }
 
 bool
@@ -140,6 +156,8 @@ Parameters::print_parameters_numerical_parameters(dealii::ConditionalOStream con
   pcout << std::endl << "Numerical parameters:" << std::endl;
 
   print_parameter(pcout, "Enable cell-based face loops", enable_cell_based_face_loops);
+
+  print_parameter(pcout, "Renumber DoFs for data locality", renumber_dofs_for_data_locality);
 }
 
 
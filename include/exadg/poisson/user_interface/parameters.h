@@ -123,6 +123,13 @@ public:
   // individual cells (for example block Jacobi). With this parameter, the loop structure
   // can be changed to such an algorithm (cell_based_face_loops).
   bool enable_cell_based_face_loops;
+
+  // Renumber the DoFs in the order in which they are accessed by the cell batches of the
+  // matrix-free loops, which improves the cache locality of vector accesses, in particular of face
+  // integrals in DG discretizations. The DoFs of all multigrid levels are renumbered in the same
+  // way. Only implemented for ElementType::Hypercube and, in combination with a multigrid
+  // preconditioner, MultigridVariant::GlobalCoarsening.
+  bool renumber_dofs_for_data_locality;
 };
 
 } // namespace Poisson
@@ -26,7 +26,6 @@
 #include <exadg/postprocessor/pressure_difference_calculation.h>
 #include <exadg/utilities/create_directories.h>
 #include <exadg/utilities/print_functions.h>
-#include <exadg/vector_tools/point_value.h>
 
 namespace ExaDG
 {
@@ -44,6 +43,8 @@ PressureDifferenceData<dim>::print(dealii::ConditionalOStream & pcout, bool cons
 
     print_parameter(pcout, "Directory", directory);
     print_parameter(pcout, "Filename", filename);
+
+    print_parameter(pcout, "Update points before evaluation", update_points_before_evaluation);
   }
 }
 
@@ -67,7 +68,22 @@ PressureDifferenceCalculator<dim, Number>::setup(
   time_control.setup(data.time_control_data);
 
   if(data.time_control_data.is_active)
+  {
     create_directories(data.directory, mpi_comm);
+
+    reinit_point_evaluation_plan();
+  }
+}
+
+template<int dim, typename Number>
+void
+PressureDifferenceCalculator<dim, Number>::reinit_point_evaluation_plan() const
+{
+  std::vector<dealii::Point<dim>> const points = {data.point_1, data.point_2};
+
+  point_evaluation_plan.reinit(*dof_handler_pressure, *mapping, points, mpi_comm);
+
+  AssertThrow(point_evaluation_plan.all_points_found(), dealii::ExcMessage("No points found."));
 }
 
 template<int dim, typename Number>
@@ -75,18 +91,13 @@ void
 PressureDifferenceCalculator<dim, Number>::evaluate(VectorType const & pressure,
                                                     double const       time) const
 {
-  Number pressure_1 = 0.0, pressure_2 = 0.0;
-
-  dealii::Point<dim> point_1, point_2;
-  point_1 = data.point_1;
-  point_2 = data.point_2;
+  if(data.update_points_before_evaluation)
+    reinit_point_evaluation_plan();
 
-  evaluate_scalar_quantity_in_point(
-    pressure_1, *dof_handler_pressure, *mapping, pressure, point_1, mpi_comm);
-  evaluate_scalar_quantity_in_point(
-    pressure_2, *dof_handler_pressure, *mapping, pressure, point_2, mpi_comm);
+  std::vector<dealii::Tensor<1, 1, Number>> pressure_values;
+  point_evaluation_plan.evaluate(pressure_values, pressure, mpi_comm);
 
-  Number const pressure_difference = pressure_1 - pressure_2;
+  Number const pressure_difference = pressure_values[0][0] - pressure_values[1][0];
 
   if(dealii::Utilities::MPI::this_mpi_process(mpi_comm) == 0)
   {
@@ -32,13 +32,15 @@
 // ExaDG
 #include <exadg/postprocessor/solution_field.h>
 #include <exadg/postprocessor/time_control.h>
+#include <exadg/vector_tools/point_evaluation_plan.h>
 
 namespace ExaDG
 {
 template<int dim>
 struct PressureDifferenceData
 {
-  PressureDifferenceData() : directory("output/"), filename("pressure_difference")
+  PressureDifferenceData()
+    : directory("output/"), filename("pressure_difference"), update_points_before_evaluation(true)
   {
   }
 
@@ -60,6 +62,13 @@ struct PressureDifferenceData
   std::string directory;
   std::string filename;
 
+  /*
+   *  Search the cells around the points and evaluate the shape values in the points again before
+   *  each evaluation, which is necessary in case of a moving mesh. For a fixed mesh, set this
+   *  parameter to false so that this is done only once during setup.
+   */
+  bool update_points_before_evaluation;
+
   void
   print(dealii::ConditionalOStream & pcout, bool const unsteady) const;
 };
@@ -83,6 +92,9 @@ public:
   TimeControl time_control;
 
 private:
+  void
+  reinit_point_evaluation_plan() const;
+
   MPI_Comm const mpi_comm;
 
   mutable bool clear_files;
@@ -91,6 +103,8 @@ private:
   dealii::SmartPointer<dealii::Mapping<dim> const>    mapping;
 
   PressureDifferenceData<dim> data;
+
+  mutable PointEvaluationPlan<dim, 1, Number> point_evaluation_plan;
 };
 
 } // namespace ExaDG
@@ -92,9 +92,17 @@ public:
     AMGData amg_data;
   };
 
-  MGCoarseKrylov(Operator const &       matrix,
-                 AdditionalData const & additional_data,
-                 MPI_Comm const &       comm)
+  /*
+   * The preconditioner MultigridCoarseGridPreconditioner::AMGLowOrderRefined requires
+   * information about the discretization (DoFHandler, Mapping) that is not available via the
+   * operator. It is therefore set up outside of this class and handed over via
+   * preconditioner_low_order_refined.
+   */
+  MGCoarseKrylov(
+    Operator const &                                     matrix,
+    AdditionalData const &                               additional_data,
+    MPI_Comm const &                                     comm,
+    std::shared_ptr<PreconditionerBase<MultigridNumber>> preconditioner_low_order_refined = nullptr)
     : coarse_matrix(matrix), additional_data(additional_data), mpi_comm(comm)
   {
     if(additional_data.preconditioner == MultigridCoarseGridPreconditioner::PointJacobi)
@@ -114,8 +122,10 @@ public:
       {
 #ifdef DEAL_II_WITH_TRILINOS
         preconditioner_amg =
-          std::make_shared<PreconditionerML<Operator, NumberAMG>>(matrix,
-                                                                  additional_data.amg_data.ml_data);
+          std::make_shared<PreconditionerML<Operator, NumberAMG>>(
+            matrix,
+            additional_data.amg_data.ml_data,
+            additional_data.amg_data.reuse_coarsening_structure);
 #else
         AssertThrow(false, dealii::ExcMessage("deal.II is not compiled with Trilinos!"));
 #endif
@@ -134,13 +144,22 @@ public:
         AssertThrow(false, dealii::ExcNotImplemented());
       }
     }
+    else if(additional_data.preconditioner ==
+            MultigridCoarseGridPreconditioner::AMGLowOrderRefined)
+    {
+      AssertThrow(preconditioner_low_order_refined.get() != nullptr,
+                  dealii::ExcMessage("Low-order refined preconditioner has not been provided."));
+
+      preconditioner = preconditioner_low_order_refined;
+    }
     else
     {
       AssertThrow(
         additional_data.preconditioner == MultigridCoarseGridPreconditioner::None ||
           additional_data.preconditioner == MultigridCoarseGridPreconditioner::PointJacobi ||
           additional_data.preconditioner == MultigridCoarseGridPreconditioner::BlockJacobi ||
-          additional_data.preconditioner == MultigridCoarseGridPreconditioner::AMG,
+          additional_data.preconditioner == MultigridCoarseGridPreconditioner::AMG ||
+          additional_data.preconditioner == MultigridCoarseGridPreconditioner::AMGLowOrderRefined,
         dealii::ExcMessage("Specified preconditioner for PCG coarse grid solver not implemented."));
     }
   }
@@ -157,7 +176,9 @@ public:
       // do nothing
     }
     else if(additional_data.preconditioner == MultigridCoarseGridPreconditioner::PointJacobi ||
-            additional_data.preconditioner == MultigridCoarseGridPreconditioner::BlockJacobi)
+            additional_data.preconditioner == MultigridCoarseGridPreconditioner::BlockJacobi ||
+            additional_data.preconditioner ==
+              MultigridCoarseGridPreconditioner::AMGLowOrderRefined)
     {
       preconditioner->update();
     }
@@ -283,7 +304,9 @@ public:
           solver_data.use_preconditioner = false;
         }
         else if(additional_data.preconditioner == MultigridCoarseGridPreconditioner::PointJacobi ||
-                additional_data.preconditioner == MultigridCoarseGridPreconditioner::BlockJacobi)
+                additional_data.preconditioner == MultigridCoarseGridPreconditioner::BlockJacobi ||
+                additional_data.preconditioner ==
+                  MultigridCoarseGridPreconditioner::AMGLowOrderRefined)
         {
           solver_data.use_preconditioner = true;
         }
@@ -310,7 +333,9 @@ public:
           solver_data.use_preconditioner = false;
         }
         else if(additional_data.preconditioner == MultigridCoarseGridPreconditioner::PointJacobi ||
-                additional_data.preconditioner == MultigridCoarseGridPreconditioner::BlockJacobi)
+                additional_data.preconditioner == MultigridCoarseGridPreconditioner::BlockJacobi ||
+                additional_data.preconditioner ==
+                  MultigridCoarseGridPreconditioner::AMGLowOrderRefined)
         {
           solver_data.use_preconditioner = true;
         }
@@ -404,7 +429,9 @@ public:
     {
 #ifdef DEAL_II_WITH_TRILINOS
       amg_preconditioner =
-        std::make_shared<PreconditionerML<Operator, NumberAMG>>(op, data.ml_data);
+        std::make_shared<PreconditionerML<Operator, NumberAMG>>(op,
+                                                                data.ml_data,
+                                                                data.reuse_coarsening_structure);
 #else
       AssertThrow(false, dealii::ExcMessage("deal.II is not compiled with Trilinos!"));
 #endif
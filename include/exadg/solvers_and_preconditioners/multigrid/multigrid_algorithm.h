@@ -32,6 +32,7 @@
 #include <deal.II/multigrid/multigrid.h>
 
 // ExaDG
+#include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
 #include <exadg/solvers_and_preconditioners/multigrid/transfers/mg_transfer.h>
 #include <exadg/utilities/timer_tree.h>
 
@@ -47,8 +48,9 @@
 namespace ExaDG
 {
 /*
- * Re-implementation of multigrid preconditioner (V-cycle) in order to have more direct control over
- * its individual components and avoid inner products and other expensive stuff.
+ * Re-implementation of multigrid preconditioner (V-, W-, F-, and K-cycle) in order to have more
+ * direct control over its individual components and avoid inner products and other expensive
+ * stuff (apart from the K-cycle, which requires inner products on the intermediate levels).
  */
 template<typename VectorType, typename MatrixType, typename SmootherType>
 class MultigridAlgorithm
@@ -59,7 +61,7 @@ public:
                      MGTransfer<VectorType> const &                               transfer,
                      dealii::MGLevelObject<std::shared_ptr<SmootherType>> const & smoother,
                      MPI_Comm const &                                             comm,
-                     unsigned int const                                           n_cycles = 1)
+                     MultigridCycle const cycle_type = MultigridCycle::V)
     : minlevel(matrix.min_level()),
       maxlevel(matrix.max_level()),
       defect(minlevel, maxlevel),
@@ -70,10 +72,8 @@ public:
       transfer(transfer),
       smoother(&smoother, typeid(*this).name()),
       mpi_comm(comm),
-      n_cycles(n_cycles)
+      cycle_type(cycle_type)
   {
-    AssertThrow(n_cycles == 1, dealii::ExcNotImplemented());
-
     for(unsigned int level = minlevel; level <= maxlevel; ++level)
     {
       matrix[level]->initialize_dof_vector(solution[level]);
@@ -81,6 +81,22 @@ public:
       t[level]      = solution[level];
     }
 
+    // the coarse-grid solver is called with a non-zero initial guess if multigrid is used as a
+    // solver (any cycle type, including maxlevel == minlevel) or for cycles other than the V-cycle
+    coarse_correction = solution[minlevel];
+
+    // Krylov vectors on intermediate levels
+    if(cycle_type == MultigridCycle::K)
+    {
+      krylov_c.resize(minlevel, maxlevel);
+      krylov_v.resize(minlevel, maxlevel);
+      for(unsigned int level = minlevel + 1; level < maxlevel; ++level)
+      {
+        krylov_c[level] = solution[level];
+        krylov_v[level] = solution[level];
+      }
+    }
+
     timer_tree = std::make_shared<TimerTree>();
   }
 
@@ -92,13 +108,9 @@ public:
     dealii::Timer timer;
 #endif
 
-    for(unsigned int i = minlevel; i < maxlevel; i++)
-    {
-      defect[i] = 0.0;
-    }
     defect[maxlevel].copy_locally_owned_data_from(src);
 
-    v_cycle(maxlevel, false);
+    cycle(maxlevel, false, cycle_type);
 
     dst.copy_locally_owned_data_from(solution[maxlevel]);
 
@@ -130,12 +142,7 @@ public:
     bool converged = norm_r_0 < abstol;
     while(!converged)
     {
-      for(unsigned int i = minlevel; i < maxlevel; i++)
-      {
-        defect[i] = 0.0;
-      }
-
-      v_cycle(maxlevel, true);
+      cycle(maxlevel, true, cycle_type);
 
       // calculate residual and check convergence
       norm_r = calculate_residual(residual);
@@ -167,10 +174,14 @@ public:
 
 private:
   /**
-   * Implements the V-cycle
+   * Implements one multigrid cycle of the given type on the given level. If
+   * multigrid_is_a_solver is true, the current content of solution[level] is used as initial
+   * guess, otherwise it is assumed to be zero.
    */
   void
-  v_cycle(unsigned int const level, bool const multigrid_is_a_solver) const
+  cycle(unsigned int const   level,
+        bool const           multigrid_is_a_solver,
+        MultigridCycle const type) const
   {
 #if ENABLE_TIMING
     dealii::Timer timer;
@@ -183,10 +194,21 @@ private:
       timer.restart();
 #endif
 
-      (*coarse)(level, solution[level], defect[level]);
+      if(multigrid_is_a_solver)
+      {
+        // correct the current approximation by the coarse-grid solution of the residual equation
+        (*matrix)[level]->vmult(t[level], solution[level]);
+        t[level].sadd(-1.0, 1.0, defect[level]);
+        (*coarse)(level, coarse_correction, t[level]);
+        solution[level] += coarse_correction;
+      }
+      else
+      {
+        (*coarse)(level, solution[level], defect[level]);
+      }
 
 #if ENABLE_TIMING
-      timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
+      timer_tree->insert({"Multigrid", "coarse grid solver"}, timer.wall_time());
 #endif
     }
     else
@@ -214,6 +236,9 @@ private:
       // restriction
       (*matrix)[level]->vmult_interface_down(t[level], solution[level]);
       t[level].sadd(-1.0, 1.0, defect[level]);
+      // the coarser level may be visited several times (W-, F-, and K-cycle), so its defect is
+      // reset here instead of once per cycle in vmult() and solve()
+      defect[level - 1] = 0.0;
       transfer.restrict_and_add(level, defect[level - 1], t[level]);
 
 #if ENABLE_TIMING
@@ -221,7 +246,31 @@ private:
 #endif
 
       // coarse grid correction
-      v_cycle(level - 1, false);
+      if(type == MultigridCycle::V)
+      {
+        cycle(level - 1, false, MultigridCycle::V);
+      }
+      else if(type == MultigridCycle::W)
+      {
+        cycle(level - 1, false, MultigridCycle::W);
+        cycle(level - 1, true, MultigridCycle::W);
+      }
+      else if(type == MultigridCycle::F)
+      {
+        cycle(level - 1, false, MultigridCycle::F);
+        cycle(level - 1, true, MultigridCycle::V);
+      }
+      else if(type == MultigridCycle::K)
+      {
+        if(level - 1 == minlevel)
+          cycle(level - 1, false, MultigridCycle::K);
+        else
+          krylov_coarse_grid_correction(level - 1);
+      }
+      else
+      {
+        AssertThrow(false, dealii::ExcNotImplemented());
+      }
 
 #if ENABLE_TIMING
       timer.restart();
@@ -239,6 +288,80 @@ private:
     }
   }
 
+  /**
+   * Coarse-grid correction of the K-cycle: approximates the solution of A e = r on the given
+   * level, with r = defect[level], by (at most) two iterations of flexible CG preconditioned by
+   * the K-cycle on this level. The result is written to solution[level].
+   */
+  void
+  krylov_coarse_grid_correction(unsigned int const level) const
+  {
+    // the second iteration is skipped if the residual has been reduced sufficiently
+    double const tolerance_second_iteration = 0.25;
+
+    VectorType & r = defect[level];
+    VectorType & c = krylov_c[level];
+    VectorType & v = krylov_v[level];
+
+    double const norm_r = r.l2_norm();
+
+    // first iteration
+    cycle(level, false, MultigridCycle::K);
+
+#if ENABLE_TIMING
+    dealii::Timer timer;
+#endif
+
+    c = solution[level];
+    (*matrix)[level]->vmult(v, c);
+
+    double const rho_1   = c * v;
+    double const alpha_1 = c * r;
+
+    if(rho_1 <= 0.0)
+      return;
+
+    // r is overwritten by the residual after the first iteration
+    r.add(-alpha_1 / rho_1, v);
+
+    if(r.l2_norm() <= tolerance_second_iteration * norm_r)
+    {
+      solution[level].equ(alpha_1 / rho_1, c);
+
+#if ENABLE_TIMING
+      timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
+#endif
+      return;
+    }
+
+#if ENABLE_TIMING
+    timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
+#endif
+
+    // second iteration
+    cycle(level, false, MultigridCycle::K);
+
+#if ENABLE_TIMING
+    timer.restart();
+#endif
+
+    (*matrix)[level]->vmult(t[level], solution[level]);
+
+    double const gamma   = solution[level] * v;
+    double const beta    = solution[level] * t[level];
+    double const alpha_2 = solution[level] * r;
+    double const rho_2   = beta - gamma * gamma / rho_1;
+
+    if(rho_2 > 0.0)
+      solution[level].sadd(alpha_2 / rho_2, alpha_1 / rho_1 - gamma * alpha_2 / (rho_1 * rho_2), c);
+    else
+      solution[level].equ(alpha_1 / rho_1, c);
+
+#if ENABLE_TIMING
+    timer_tree->insert({"Multigrid", "level " + std::to_string(level)}, timer.wall_time());
+#endif
+  }
+
   /**
    * Coarsest level.
    */
@@ -265,6 +388,18 @@ private:
    */
   mutable dealii::MGLevelObject<VectorType> t;
 
+  /**
+   * Correction computed by the coarse-grid solver if the coarse level is visited with a non-zero
+   * initial guess (W- and F-cycle).
+   */
+  mutable VectorType coarse_correction;
+
+  /**
+   * Auxiliary vectors of the flexible CG iterations of the K-cycle.
+   */
+  mutable dealii::MGLevelObject<VectorType> krylov_c;
+  mutable dealii::MGLevelObject<VectorType> krylov_v;
+
   /**
    * The matrix for each level.
    */
@@ -287,7 +422,7 @@ private:
 
   MPI_Comm const mpi_comm;
 
-  unsigned int const n_cycles;
+  MultigridCycle const cycle_type;
 
   std::shared_ptr<TimerTree> timer_tree;
 };
@@ -64,6 +64,21 @@ enum class PSequenceType
   Manual
 };
 
+/*
+ * V: one coarse-grid correction per level
+ * W: two coarse-grid corrections per level
+ * F: coarse-grid correction by one F-cycle followed by one V-cycle
+ * K: coarse-grid correction by two iterations of flexible CG preconditioned by the K-cycle on the
+ *    next coarser level (Krylov-accelerated cycle, Notay and Vassilevski 2008)
+ */
+enum class MultigridCycle
+{
+  V,
+  W,
+  F,
+  K
+};
+
 enum class MultigridSmoother
 {
   Chebyshev,
@@ -91,7 +106,8 @@ enum class MultigridCoarseGridPreconditioner
   None,
   PointJacobi,
   BlockJacobi,
-  AMG
+  AMG,
+  AMGLowOrderRefined
 };
 
 struct AMGData
@@ -100,6 +116,8 @@ struct AMGData
   {
     amg_type = AMGType::ML;
 
+    reuse_coarsening_structure = false;
+
 #ifdef DEAL_II_WITH_TRILINOS
     ml_data.smoother_sweeps = 1;
     ml_data.n_cycles        = 1;
@@ -130,6 +148,7 @@ struct AMGData
       print_parameter(pcout, "    Number of cycles", ml_data.n_cycles);
       print_parameter(pcout, "    Smoother type", ml_data.smoother_type);
 #endif
+      print_parameter(pcout, "    Reuse coarsening structure", reuse_coarsening_structure);
     }
     else if(amg_type == AMGType::BoomerAMG)
     {
@@ -149,6 +168,11 @@ struct AMGData
 
   AMGType amg_type;
 
+  // If the preconditioner is updated, the sparse matrix is refilled in place (same sparsity
+  // pattern) and the aggregates computed during the first setup are reused, so that only the
+  // values of the multilevel hierarchy are recomputed. Only relevant for AMGType::ML.
+  bool reuse_coarsening_structure;
+
 #ifdef DEAL_II_WITH_TRILINOS
   dealii::TrilinosWrappers::PreconditionAMG::AdditionalData ml_data;
 #endif
@@ -173,7 +197,10 @@ struct SmootherData
       iterations(5),
       relaxation_factor(0.8),
       smoothing_range(20),
-      iterations_eigenvalue_estimation(20)
+      iterations_eigenvalue_estimation(20),
+      reuse_eigenvalue_estimates(false),
+      iterations_eigenvalue_refresh(4),
+      eigenvalue_reuse_tolerance(0.0)
   {
   }
 
@@ -193,6 +220,12 @@ struct SmootherData
     {
       print_parameter(pcout, "Smoothing range", smoothing_range);
       print_parameter(pcout, "Iterations eigenvalue estimation", iterations_eigenvalue_estimation);
+      print_parameter(pcout, "Reuse eigenvalue estimates", reuse_eigenvalue_estimates);
+      if(reuse_eigenvalue_estimates)
+      {
+        print_parameter(pcout, "Iterations eigenvalue refresh", iterations_eigenvalue_refresh);
+        print_parameter(pcout, "Eigenvalue reuse tolerance", eigenvalue_reuse_tolerance);
+      }
     }
   }
 
@@ -213,6 +246,21 @@ struct SmootherData
 
   // number of CG iterations for estimation of eigenvalues
   unsigned int iterations_eigenvalue_estimation;
+
+  // Chebyshev smoother: cache the eigenvalue estimates of all levels when the smoothers are
+  // updated (e.g., in time-dependent problems). The CG-based estimation is only done for the
+  // first setup and the first change of the operator. Afterwards, the cached maximum eigenvalue
+  // is rescaled by a few power iterations (warm-started with the vector of the previous update),
+  // see iterations_eigenvalue_refresh.
+  bool reuse_eigenvalue_estimates;
+
+  // number of power iterations to refresh a cached eigenvalue estimate
+  unsigned int iterations_eigenvalue_refresh;
+
+  // The operator state is measured via the diagonal of the operator. If the relative change of
+  // the diagonal compared to the last eigenvalue estimate is below this tolerance, the cached
+  // eigenvalues are reused without any operator evaluation.
+  double eigenvalue_reuse_tolerance;
 };
 
 struct CoarseGridData
@@ -234,7 +282,8 @@ struct CoarseGridData
     solver_data.print(pcout);
 
     if(solver == MultigridCoarseGridSolver::AMG ||
-       preconditioner == MultigridCoarseGridPreconditioner::AMG)
+       preconditioner == MultigridCoarseGridPreconditioner::AMG ||
+       preconditioner == MultigridCoarseGridPreconditioner::AMGLowOrderRefined)
     {
       amg_data.print(pcout);
     }
@@ -259,8 +308,10 @@ struct MultigridData
   MultigridData()
     : type(MultigridType::hMG),
       p_sequence(PSequenceType::Bisect),
+      cycle(MultigridCycle::V),
       smoother_data(SmootherData()),
-      coarse_problem(CoarseGridData())
+      coarse_problem(CoarseGridData()),
+      renumber_dofs_for_data_locality(false)
   {
   }
 
@@ -274,6 +325,8 @@ struct MultigridData
       print_parameter(pcout, "p-sequence", p_sequence);
     }
 
+    print_parameter(pcout, "Multigrid cycle", cycle);
+
     smoother_data.print(pcout);
 
     coarse_problem.print(pcout);
@@ -294,11 +347,20 @@ struct MultigridData
   // Sequence of polynomial degrees during p-multigrid
   PSequenceType p_sequence;
 
+  // Type of multigrid cycle
+  MultigridCycle cycle;
+
   // Smoother data
   SmootherData smoother_data;
 
   // Coarse grid problem
   CoarseGridData coarse_problem;
+
+  // Renumber the DoFs of all multigrid levels for data locality in matrix-free loops, see
+  // renumber_dofs_for_data_locality(). Since vectors are copied between the PDE operator and the
+  // finest multigrid level, this option has to match the DoF numbering of the PDE operator and is
+  // therefore set by the PDE operator. Only implemented for MultigridVariant::GlobalCoarsening.
+  bool renumber_dofs_for_data_locality;
 };
 
 } // namespace ExaDG
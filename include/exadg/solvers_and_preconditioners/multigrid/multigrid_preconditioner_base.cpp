@@ -24,6 +24,7 @@
 #include <deal.II/distributed/repartitioning_policy_tools.h>
 #include <deal.II/fe/fe_dgq.h>
 #include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_raviart_thomas.h>
 #include <deal.II/fe/fe_simplex_p.h>
 #include <deal.II/fe/fe_system.h>
 #include <deal.II/fe/mapping_q.h>
@@ -35,6 +36,7 @@
 #include <exadg/grid/grid_utilities.h>
 #include <exadg/grid/mapping_dof_vector.h>
 #include <exadg/matrix_free/categorization.h>
+#include <exadg/matrix_free/dof_renumbering.h>
 #include <exadg/solvers_and_preconditioners/multigrid/coarse_grid_solvers.h>
 #include <exadg/solvers_and_preconditioners/multigrid/constraints.h>
 #include <exadg/solvers_and_preconditioners/multigrid/multigrid_algorithm.h>
@@ -45,11 +47,24 @@
 #include <exadg/solvers_and_preconditioners/multigrid/smoothers/jacobi_smoother.h>
 #include <exadg/solvers_and_preconditioners/multigrid/transfers/mg_transfer_global_coarsening.h>
 #include <exadg/solvers_and_preconditioners/multigrid/transfers/mg_transfer_global_refinement.h>
+#include <exadg/solvers_and_preconditioners/multigrid/transfers/mg_transfer_hdiv.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/low_order_refined_preconditioner.h>
 #include <exadg/solvers_and_preconditioners/utilities/compute_eigenvalues.h>
 #include <exadg/utilities/mpi.h>
 
 namespace ExaDG
 {
+namespace
+{
+// Raviart-Thomas elements need dedicated DoFHandlers and transfer operators on the levels
+template<int dim>
+bool
+is_hdiv_conforming(dealii::FiniteElement<dim> const & fe)
+{
+  return fe.conforming_space == dealii::FiniteElementData<dim>::Hdiv;
+}
+} // namespace
+
 template<int dim, typename Number>
 MultigridPreconditionerBase<dim, Number>::MultigridPreconditionerBase(MPI_Comm const & comm)
   : n_levels(1),
@@ -94,6 +109,11 @@ MultigridPreconditionerBase<dim, Number>::initialize(
 
   this->initialize_levels(this->triangulation, fe.degree, is_dg);
 
+  // the triangulation might have changed, so that the multigrid mappings have to be set up anew
+  this->multigrid_mapping_local_smoothing.reset();
+  this->multigrid_mapping_global_coarsening.reset();
+  this->coarse_grid_mappings.clear();
+
   this->initialize_mapping();
 
   this->initialize_dof_handler_and_constraints(operator_is_singular,
@@ -364,16 +384,28 @@ MultigridPreconditionerBase<dim, Number>::initialize_mapping()
   {
     if(multigrid_variant == MultigridVariant::GlobalCoarsening)
     {
-      MappingTools::initialize_multigrid(coarse_grid_mappings,
-                                         mapping_q_cache,
-                                         coarse_triangulations);
+      if(multigrid_mapping_global_coarsening.get() == nullptr)
+      {
+        multigrid_mapping_global_coarsening =
+          std::make_shared<MappingTools::MultigridMappingGlobalCoarsening<dim, Number>>(
+            coarse_triangulations, mapping_q_cache->get_degree());
+      }
+
+      multigrid_mapping_global_coarsening->update(coarse_grid_mappings, *mapping_q_cache);
     }
     else if(multigrid_variant == MultigridVariant::LocalSmoothing)
     {
-      mapping_dof_vector =
-        std::make_shared<MappingDoFVector<dim, Number>>(mapping_q_cache->get_degree());
+      if(multigrid_mapping_local_smoothing.get() == nullptr)
+      {
+        mapping_dof_vector =
+          std::make_shared<MappingDoFVector<dim, Number>>(mapping_q_cache->get_degree());
 
-      MappingTools::initialize_multigrid(mapping_dof_vector, mapping_q_cache, *triangulation);
+        multigrid_mapping_local_smoothing =
+          std::make_shared<MappingTools::MultigridMappingLocalSmoothing<dim, Number>>(
+            *triangulation, mapping_q_cache->get_degree());
+      }
+
+      multigrid_mapping_local_smoothing->update(*mapping_dof_vector, *mapping_q_cache);
     }
     else
     {
@@ -452,6 +484,18 @@ MultigridPreconditionerBase<dim, Number>::do_initialize_dof_handler_and_constrai
   dof_handlers.resize(0, this->n_levels - 1);
   constraints.resize(0, this->n_levels - 1);
 
+  bool const is_hdiv = is_hdiv_conforming(fe);
+
+  if(is_hdiv)
+  {
+    AssertThrow(multigrid_variant == MultigridVariant::LocalSmoothing,
+                dealii::ExcMessage("Multigrid for H(div)-conforming elements is currently only "
+                                   "implemented for MultigridVariant::LocalSmoothing."));
+    AssertThrow(not(data.involves_c_transfer()),
+                dealii::ExcMessage("Multigrid for H(div)-conforming elements does not support "
+                                   "c-transfer. Use hMG, pMG, hpMG, or phMG instead."));
+  }
+
   // this type of transfer has to be used for triangulations with hanging nodes
   if(multigrid_variant == MultigridVariant::GlobalCoarsening)
   {
@@ -487,6 +531,9 @@ MultigridPreconditionerBase<dim, Number>::do_initialize_dof_handler_and_constrai
       else
         AssertThrow(false, dealii::ExcMessage("Only hypercube or simplex elements are supported."));
 
+      if(data.renumber_dofs_for_data_locality)
+        renumber_dofs_for_data_locality(*dof_handler);
+
       dof_handlers[i].reset(dof_handler);
 
       auto affine_constraints_own = new dealii::AffineConstraints<MultigridNumber>();
@@ -538,6 +585,9 @@ MultigridPreconditionerBase<dim, Number>::do_initialize_dof_handler_and_constrai
   }
   else if(multigrid_variant == MultigridVariant::LocalSmoothing)
   {
+    AssertThrow(not(data.renumber_dofs_for_data_locality),
+                dealii::ExcMessage("Renumbering of DoFs for data locality is only implemented for "
+                                   "MultigridVariant::GlobalCoarsening."));
     AssertThrow(triangulation->has_hanging_nodes() == false,
                 dealii::ExcMessage("Hanging nodes are only supported with the option "
                                    "use_global_coarsening enabled."));
@@ -561,7 +611,13 @@ MultigridPreconditionerBase<dim, Number>::do_initialize_dof_handler_and_constrai
       auto dof_handler = new dealii::DoFHandler<dim>(*triangulation);
 
       // distribute dofs
-      if(level.is_dg)
+      if(is_hdiv)
+      {
+        // the degree of a level refers to the normal component, see the constructor of
+        // FE_RaviartThomasNodal
+        dof_handler->distribute_dofs(dealii::FE_RaviartThomasNodal<dim>(level.degree - 1));
+      }
+      else if(level.is_dg)
       {
         dof_handler->distribute_dofs(
           dealii::FESystem<dim>(dealii::FE_DGQ<dim>(level.degree), n_components));
@@ -580,7 +636,9 @@ MultigridPreconditionerBase<dim, Number>::do_initialize_dof_handler_and_constrai
       constrained_dofs->clear();
       constrained_dofs->initialize(*dof_handler);
 
-      if(not(level.is_dg))
+      // For Raviart-Thomas elements, all degrees of freedom on a boundary face refer to the
+      // normal component, which is constrained strongly.
+      if(not(level.is_dg) or is_hdiv)
       {
         for(auto it : dirichlet_bc)
         {
@@ -613,7 +671,7 @@ MultigridPreconditionerBase<dim, Number>::do_initialize_dof_handler_and_constrai
     {
       auto affine_constraints_own = new dealii::AffineConstraints<MultigridNumber>;
 
-      ConstraintUtil::add_constraints<dim>(level_info[level].is_dg(),
+      ConstraintUtil::add_constraints<dim>(level_info[level].is_dg() and not(is_hdiv),
                                            is_singular,
                                            *dof_handlers[level],
                                            *affine_constraints_own,
@@ -695,6 +753,7 @@ void
 MultigridPreconditionerBase<dim, Number>::initialize_smoothers()
 {
   this->smoothers.resize(0, this->n_levels - 1);
+  this->chebyshev_eigenvalue_caches.resize(0, this->n_levels - 1);
 
   // skip the coarsest level
   for(unsigned int level = coarse_level + 1; level <= fine_level; level++)
@@ -971,8 +1030,29 @@ MultigridPreconditionerBase<dim, Number>::initialize_coarse_solver(bool const op
       additional_data.preconditioner       = data.coarse_problem.preconditioner;
       additional_data.amg_data             = data.coarse_problem.amg_data;
 
-      coarse_grid_solver =
-        std::make_shared<MGCoarseKrylov<Operator>>(coarse_operator, additional_data, mpi_comm);
+      std::shared_ptr<PreconditionerBase<MultigridNumber>> preconditioner_low_order_refined;
+      if(data.coarse_problem.preconditioner ==
+         MultigridCoarseGridPreconditioner::AMGLowOrderRefined)
+      {
+#ifdef DEAL_II_WITH_TRILINOS
+        unsigned int const h_level = (multigrid_variant == MultigridVariant::GlobalCoarsening) ?
+                                       dealii::numbers::invalid_unsigned_int :
+                                       level_info[0].h_level();
+
+        preconditioner_low_order_refined =
+          std::make_shared<LowOrderRefinedAMGPreconditioner<dim, MultigridNumber>>(
+            *dof_handlers[0],
+            get_mapping(level_info[0].h_level()),
+            *constraints[0],
+            h_level,
+            data.coarse_problem.amg_data);
+#else
+        AssertThrow(false, dealii::ExcMessage("deal.II is not compiled with Trilinos!"));
+#endif
+      }
+
+      coarse_grid_solver = std::make_shared<MGCoarseKrylov<Operator>>(
+        coarse_operator, additional_data, mpi_comm, preconditioner_low_order_refined);
       break;
     }
     case MultigridCoarseGridSolver::AMG:
@@ -1026,11 +1106,22 @@ MultigridPreconditionerBase<dim, Number>::do_initialize_transfer_operators(
   }
   else if(multigrid_variant == MultigridVariant::LocalSmoothing)
   {
-    auto tmp = std::make_shared<MGTransferGlobalRefinement<dim, MultigridNumber, VectorTypeMG>>();
+    if(is_hdiv_conforming(matrix_free_objects[fine_level]->get_dof_handler(dof_index).get_fe()))
+    {
+      auto tmp = std::make_shared<MGTransferHDIV<dim, MultigridNumber, VectorTypeMG>>();
 
-    tmp->reinit(*mapping, matrix_free_objects, constrained_dofs, dof_index);
+      tmp->reinit(matrix_free_objects, dof_index);
 
-    transfers = tmp;
+      transfers = tmp;
+    }
+    else
+    {
+      auto tmp = std::make_shared<MGTransferGlobalRefinement<dim, MultigridNumber, VectorTypeMG>>();
+
+      tmp->reinit(*mapping, matrix_free_objects, constrained_dofs, dof_index);
+
+      transfers = tmp;
+    }
   }
   else
   {
@@ -1044,7 +1135,12 @@ MultigridPreconditionerBase<dim, Number>::initialize_multigrid_algorithm()
 {
   this
     ->multigrid_algorithm = std::make_shared<MultigridAlgorithm<VectorTypeMG, Operator, Smoother>>(
-    this->operators, *this->coarse_grid_solver, *this->transfers, this->smoothers, this->mpi_comm);
+    this->operators,
+    *this->coarse_grid_solver,
+    *this->transfers,
+    this->smoothers,
+    this->mpi_comm,
+    data.cycle);
 }
 
 template<int dim, typename Number>
@@ -1073,7 +1169,11 @@ MultigridPreconditionerBase<dim, Number>::initialize_chebyshev_smoother_point_ja
   smoother_data.eig_cg_n_iterations = data.smoother_data.iterations_eigenvalue_estimation;
 
   std::shared_ptr<Chebyshev> smoother = std::dynamic_pointer_cast<Chebyshev>(smoothers[level]);
-  smoother->initialize(mg_operator, smoother_data);
+  if(data.smoother_data.reuse_eigenvalue_estimates)
+    chebyshev_eigenvalue_caches[level].initialize_smoother(
+      *smoother, smoother_data, mg_operator, diagonal_vector, data.smoother_data);
+  else
+    smoother->initialize(mg_operator, smoother_data);
 }
 
 template<int dim, typename Number>
@@ -1095,7 +1195,20 @@ MultigridPreconditionerBase<dim, Number>::initialize_chebyshev_smoother_block_ja
   smoother_data.eig_cg_n_iterations = data.smoother_data.iterations_eigenvalue_estimation;
 
   std::shared_ptr<Chebyshev> smoother = std::dynamic_pointer_cast<Chebyshev>(smoothers[level]);
-  smoother->initialize(mg_operator, smoother_data);
+  if(data.smoother_data.reuse_eigenvalue_estimates)
+  {
+    // the diagonal is only needed to detect changes of the operator
+    VectorTypeMG inverse_diagonal;
+    mg_operator.initialize_dof_vector(inverse_diagonal);
+    mg_operator.calculate_inverse_diagonal(inverse_diagonal);
+
+    chebyshev_eigenvalue_caches[level].initialize_smoother(
+      *smoother, smoother_data, mg_operator, inverse_diagonal, data.smoother_data);
+  }
+  else
+  {
+    smoother->initialize(mg_operator, smoother_data);
+  }
 }
 
 template<int dim, typename Number>
@@ -33,6 +33,7 @@
 #include <exadg/operators/multigrid_operator_base.h>
 #include <exadg/solvers_and_preconditioners/multigrid/levels_hybrid_multigrid.h>
 #include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
+#include <exadg/solvers_and_preconditioners/multigrid/smoothers/chebyshev_eigenvalue_cache.h>
 #include <exadg/solvers_and_preconditioners/multigrid/smoothers/smoother_base.h>
 #include <exadg/solvers_and_preconditioners/multigrid/transfers/mg_transfer.h>
 #include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
@@ -45,6 +46,15 @@ class MultigridAlgorithm;
 
 template<int dim, typename Number>
 class MappingDoFVector;
+
+namespace MappingTools
+{
+template<int dim, typename Number>
+class MultigridMappingLocalSmoothing;
+
+template<int dim, typename Number>
+class MultigridMappingGlobalCoarsening;
+} // namespace MappingTools
 } // namespace ExaDG
 
 namespace dealii
@@ -141,7 +151,10 @@ public:
 protected:
   /*
    * Initialization of mapping depending on multigrid transfer type. Note that the mapping needs to
-   * be re-initialized if the domain changes over time.
+   * be re-initialized if the domain changes over time. Data structures that only depend on the
+   * topology of the mesh (e.g. the transfer operators used to interpolate the grid coordinates to
+   * the multigrid levels) are set up in the first call and are reused in subsequent calls, i.e.,
+   * only the geometry is recomputed for a moving mesh.
    */
   void
   initialize_mapping();
@@ -321,8 +334,17 @@ private:
   // used.
   std::shared_ptr<MappingDoFVector<dim, Number>> mapping_dof_vector;
 
+  // Topology-dependent data structures used to (re-)initialize the multigrid mappings.
+  std::shared_ptr<MappingTools::MultigridMappingLocalSmoothing<dim, Number>>
+    multigrid_mapping_local_smoothing;
+  std::shared_ptr<MappingTools::MultigridMappingGlobalCoarsening<dim, Number>>
+    multigrid_mapping_global_coarsening;
+
   dealii::MGLevelObject<std::shared_ptr<Smoother>> smoothers;
 
+  // eigenvalue estimates of the Chebyshev smoothers, see SmootherData::reuse_eigenvalue_estimates
+  dealii::MGLevelObject<ChebyshevEigenvalueCache<VectorTypeMG>> chebyshev_eigenvalue_caches;
+
   std::shared_ptr<dealii::MGCoarseGridBase<VectorTypeMG>> coarse_grid_solver;
 
   std::shared_ptr<MultigridAlgorithm<VectorTypeMG, Operator, Smoother>> multigrid_algorithm;
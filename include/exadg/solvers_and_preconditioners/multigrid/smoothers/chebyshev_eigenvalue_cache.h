@@ -0,0 +1,153 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_CHEBYSHEVEIGENVALUECACHE_H_
+#define INCLUDE_SOLVERS_AND_PRECONDITIONERS_CHEBYSHEVEIGENVALUECACHE_H_
+
+// C/C++
+#include <cstdlib>
+
+// deal.II
+#include <deal.II/lac/precondition.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
+#include <exadg/solvers_and_preconditioners/utilities/compute_eigenvalues.h>
+
+namespace ExaDG
+{
+/*
+ * Eigenvalue estimate of the preconditioned operator used by a Chebyshev smoother, along with the
+ * operator state (inverse diagonal) it has been computed for, see
+ * SmootherData::reuse_eigenvalue_estimates.
+ *
+ * The first estimate is the CG-based estimate of dealii::PreconditionChebyshev. Once the operator
+ * has changed by more than SmootherData::eigenvalue_reuse_tolerance, the cached estimate is
+ * rescaled by power iterations warm-started with the vector of the previous refresh. The power
+ * iteration is only set up at the first refresh, so that nothing is spent on it as long as the
+ * cached estimate is reused.
+ */
+template<typename VectorType>
+class ChebyshevEigenvalueCache
+{
+public:
+  ChebyshevEigenvalueCache()
+    : is_valid(false),
+      power_iteration_is_initialized(false),
+      max_eigenvalue(1.0),
+      power_iteration_estimate(1.0)
+  {
+  }
+
+  /*
+   * Initializes the smoother with the cached maximum eigenvalue, which is computed or refreshed
+   * if necessary. The vector inverse_diagonal describes the current state of the operator.
+   */
+  template<typename Chebyshev, typename Operator>
+  void
+  initialize_smoother(Chebyshev &                          smoother,
+                      typename Chebyshev::AdditionalData & smoother_data,
+                      Operator const &                     op,
+                      VectorType const &                   inverse_diagonal,
+                      SmootherData const &                 data)
+  {
+    bool operator_has_changed = false;
+    if(is_valid)
+    {
+      VectorType difference(inverse_diagonal);
+      difference -= cached_inverse_diagonal;
+      operator_has_changed = difference.l2_norm() / cached_inverse_diagonal.l2_norm() >
+                             data.eigenvalue_reuse_tolerance;
+    }
+
+    if(operator_has_changed and power_iteration_is_initialized)
+    {
+      // the power iteration tracks the relative change of the maximum eigenvalue
+      double const estimate = estimate_max_eigenvalue_power_iteration(
+        op, *smoother_data.preconditioner, eigenvector, data.iterations_eigenvalue_refresh);
+
+      max_eigenvalue *= estimate / power_iteration_estimate;
+
+      power_iteration_estimate = estimate;
+      cached_inverse_diagonal  = inverse_diagonal;
+    }
+    else if(operator_has_changed)
+    {
+      // First change of the operator: the maximum eigenvalue is estimated anew, and the power
+      // iteration is initialized with a random vector for the current operator.
+      is_valid = false;
+
+      eigenvector.reinit(inverse_diagonal, true);
+      // NB: initialize rand in order to obtain "reproducible" results !!!
+      srand(1);
+      for(unsigned int i = 0; i < eigenvector.locally_owned_size(); ++i)
+        eigenvector.local_element(i) = (double)rand() / RAND_MAX;
+
+      power_iteration_estimate = estimate_max_eigenvalue_power_iteration(
+        op, *smoother_data.preconditioner, eigenvector, data.iterations_eigenvalue_estimation);
+
+      power_iteration_is_initialized = true;
+    }
+
+    if(is_valid)
+    {
+      // The CG-based estimate of dealii::PreconditionChebyshev already contains a safety factor,
+      // so that the cached value is used as is and the smoother has the same eigenvalue bounds.
+      smoother_data.eig_cg_n_iterations = 0;
+      smoother_data.max_eigenvalue      = max_eigenvalue;
+
+      smoother.initialize(op, smoother_data);
+    }
+    else
+    {
+      smoother.initialize(op, smoother_data);
+      typename Chebyshev::EigenvalueInformation const eigenvalues =
+        smoother.estimate_eigenvalues(inverse_diagonal);
+
+      max_eigenvalue          = eigenvalues.max_eigenvalue_estimate;
+      cached_inverse_diagonal = inverse_diagonal;
+      is_valid                = true;
+    }
+  }
+
+  double
+  get_max_eigenvalue() const
+  {
+    return max_eigenvalue;
+  }
+
+private:
+  bool is_valid;
+  bool power_iteration_is_initialized;
+
+  double max_eigenvalue;
+  double power_iteration_estimate;
+
+  VectorType cached_inverse_diagonal;
+  VectorType eigenvector;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_SOLVERS_AND_PRECONDITIONERS_CHEBYSHEVEIGENVALUECACHE_H_ */
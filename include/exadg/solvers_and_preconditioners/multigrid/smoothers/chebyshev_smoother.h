@@ -38,6 +38,9 @@ public:
     typename dealii::PreconditionChebyshev<Operator, VectorType, PreconditionerType>::AdditionalData
       AdditionalData;
 
+  typedef typename dealii::PreconditionChebyshev<Operator, VectorType, PreconditionerType>::
+    EigenvalueInformation EigenvalueInformation;
+
   ChebyshevSmoother()
   {
   }
@@ -60,6 +63,16 @@ public:
     smoother_object.initialize(matrix, additional_data);
   }
 
+  /*
+   * Estimates the eigenvalues of the preconditioned operator according to the settings in
+   * AdditionalData. The vector src is only used to determine the vector layout.
+   */
+  EigenvalueInformation
+  estimate_eigenvalues(VectorType const & src) const
+  {
+    return smoother_object.estimate_eigenvalues(src);
+  }
+
 private:
   dealii::PreconditionChebyshev<Operator, VectorType, PreconditionerType> smoother_object;
 };
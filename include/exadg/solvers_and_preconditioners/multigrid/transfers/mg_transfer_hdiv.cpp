@@ -0,0 +1,426 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// deal.II
+#include <deal.II/base/geometry_info.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_tools.h>
+#include <deal.II/lac/vector.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/multigrid/transfers/mg_transfer_hdiv.h>
+
+namespace ExaDG
+{
+namespace
+{
+// value of a degree of freedom with constraints resolved (multigrid constraints are homogeneous)
+template<typename Number, typename VectorType>
+Number
+get_constrained_value(dealii::AffineConstraints<Number> const & constraints,
+                      VectorType const &                        vector,
+                      dealii::types::global_dof_index const     index)
+{
+  if(constraints.is_constrained(index))
+  {
+    Number value = 0.0;
+    for(auto const & entry : *constraints.get_constraint_entries(index))
+      value += entry.second * vector(entry.first);
+    return value;
+  }
+  else
+  {
+    return vector(index);
+  }
+}
+
+// transpose operation of get_constrained_value()
+template<typename Number, typename VectorType>
+void
+add_constrained_value(dealii::AffineConstraints<Number> const & constraints,
+                      VectorType &                              vector,
+                      dealii::types::global_dof_index const     index,
+                      Number const                              value)
+{
+  if(constraints.is_constrained(index))
+  {
+    for(auto const & entry : *constraints.get_constraint_entries(index))
+      vector(entry.first) += entry.second * value;
+  }
+  else
+  {
+    vector(index) += value;
+  }
+}
+
+template<typename VectorType>
+void
+add_locally_owned_part(VectorType & dst, VectorType const & src)
+{
+  for(unsigned int i = 0; i < dst.locally_owned_size(); ++i)
+    dst.local_element(i) += src.local_element(i);
+}
+} // namespace
+
+template<int dim, typename Number, typename VectorType>
+void
+MGTransferHDIV<dim, Number, VectorType>::reinit(
+  dealii::MGLevelObject<std::shared_ptr<dealii::MatrixFree<dim, Number>>> & mg_matrixfree,
+  unsigned int const                                                        dof_handler_index)
+{
+  unsigned int const min_level = mg_matrixfree.min_level();
+  unsigned int const max_level = mg_matrixfree.max_level();
+
+  level_transfers.resize(min_level, max_level);
+
+  for(unsigned int level = min_level + 1; level <= max_level; ++level)
+  {
+    reinit_level(level_transfers[level],
+                 *mg_matrixfree[level],
+                 *mg_matrixfree[level - 1],
+                 dof_handler_index);
+  }
+}
+
+template<int dim, typename Number, typename VectorType>
+void
+MGTransferHDIV<dim, Number, VectorType>::reinit_level(
+  LevelTransfer &                         transfer,
+  dealii::MatrixFree<dim, Number> const & matrixfree_fine,
+  dealii::MatrixFree<dim, Number> const & matrixfree_coarse,
+  unsigned int const                      dof_handler_index)
+{
+  dealii::DoFHandler<dim> const & dof_handler_fine =
+    matrixfree_fine.get_dof_handler(dof_handler_index);
+  dealii::DoFHandler<dim> const & dof_handler_coarse =
+    matrixfree_coarse.get_dof_handler(dof_handler_index);
+
+  dealii::FiniteElement<dim> const & fe_fine   = dof_handler_fine.get_fe();
+  dealii::FiniteElement<dim> const & fe_coarse = dof_handler_coarse.get_fe();
+
+  unsigned int const level_fine   = matrixfree_fine.get_mg_level();
+  unsigned int const level_coarse = matrixfree_coarse.get_mg_level();
+
+  AssertThrow(level_fine != dealii::numbers::invalid_unsigned_int and
+                level_coarse != dealii::numbers::invalid_unsigned_int,
+              dealii::ExcMessage("MGTransferHDIV is only implemented for local smoothing, i.e., "
+                                 "matrix-free objects need to be set up on multigrid levels."));
+
+  transfer.h_transfer = (level_fine != level_coarse);
+
+  transfer.constraints_fine   = &matrixfree_fine.get_affine_constraints(dof_handler_index);
+  transfer.constraints_coarse = &matrixfree_coarse.get_affine_constraints(dof_handler_index);
+
+  // element matrices
+  transfer.prolongation_matrices.clear();
+  transfer.interpolation_matrices.clear();
+
+  if(transfer.h_transfer)
+  {
+    AssertThrow(level_fine == level_coarse + 1 and fe_fine.degree == fe_coarse.degree,
+                dealii::ExcMessage("Between two consecutive multigrid levels, only one type of "
+                                   "transfer is allowed."));
+
+    for(unsigned int c = 0; c < dealii::GeometryInfo<dim>::max_children_per_cell; ++c)
+      transfer.prolongation_matrices.push_back(fe_coarse.get_prolongation_matrix(c));
+  }
+  else
+  {
+    AssertThrow(fe_fine.degree > fe_coarse.degree,
+                dealii::ExcMessage("Invalid polynomial degrees for p-transfer."));
+
+    // the coarse space is contained in the fine space, so that the L2-projection on the
+    // reference cell yields the embedding
+    dealii::FullMatrix<double> embedding(fe_fine.n_dofs_per_cell(), fe_coarse.n_dofs_per_cell());
+    dealii::FETools::get_projection_matrix(fe_coarse, fe_fine, embedding);
+    transfer.prolongation_matrices.push_back(embedding);
+  }
+
+  // Interpolation from fine to coarse in the least-squares sense, (sum_c P_c^T P_c)^{-1} P_c^T,
+  // which is exact for functions of the coarse space.
+  dealii::FullMatrix<double> normal_matrix(fe_coarse.n_dofs_per_cell(),
+                                           fe_coarse.n_dofs_per_cell());
+  for(auto const & prolongation : transfer.prolongation_matrices)
+    prolongation.Tmmult(normal_matrix, prolongation, true);
+  normal_matrix.gauss_jordan();
+
+  for(auto const & prolongation : transfer.prolongation_matrices)
+  {
+    dealii::FullMatrix<double> interpolation(fe_coarse.n_dofs_per_cell(),
+                                             fe_fine.n_dofs_per_cell());
+    normal_matrix.mTmult(interpolation, prolongation);
+    transfer.interpolation_matrices.push_back(interpolation);
+  }
+
+  // collect dof indices of all locally owned cells on the fine level together with the
+  // corresponding (parent) cell on the coarse level
+  transfer.matrix_index.clear();
+  transfer.dof_indices_fine.clear();
+  transfer.dof_indices_coarse.clear();
+
+  std::vector<dealii::types::global_dof_index> indices_fine(fe_fine.n_dofs_per_cell());
+  std::vector<dealii::types::global_dof_index> indices_coarse(fe_coarse.n_dofs_per_cell());
+
+  dealii::IndexSet relevant_dofs_fine(dof_handler_fine.n_dofs(level_fine));
+  dealii::IndexSet relevant_dofs_coarse(dof_handler_coarse.n_dofs(level_coarse));
+
+  for(auto const & cell : dof_handler_fine.mg_cell_iterators_on_level(level_fine))
+  {
+    if(not(cell->is_locally_owned_on_level()))
+      continue;
+
+    cell->get_mg_dof_indices(indices_fine);
+
+    if(transfer.h_transfer)
+    {
+      auto const parent = cell->parent();
+
+      // the degrees of freedom of the parent are only known if the parent is locally owned or a
+      // ghost cell on the coarse level
+      AssertThrow(parent->is_locally_owned_on_level() or parent->is_ghost_on_level(),
+                  dealii::ExcMessage("The parent of a locally owned cell is neither locally owned "
+                                     "nor a ghost cell on the coarse level. Make sure that the "
+                                     "triangulation is constructed with "
+                                     "construct_multigrid_hierarchy."));
+
+      parent->get_mg_dof_indices(indices_coarse);
+
+      unsigned int child = 0;
+      while(parent->child(child)->index() != cell->index())
+        ++child;
+
+      transfer.matrix_index.push_back(child);
+    }
+    else
+    {
+      typename dealii::DoFHandler<dim>::level_cell_iterator const cell_coarse(
+        &dof_handler_fine.get_triangulation(), level_fine, cell->index(), &dof_handler_coarse);
+      cell_coarse->get_mg_dof_indices(indices_coarse);
+
+      transfer.matrix_index.push_back(0);
+    }
+
+    transfer.dof_indices_fine.insert(transfer.dof_indices_fine.end(),
+                                     indices_fine.begin(),
+                                     indices_fine.end());
+    transfer.dof_indices_coarse.insert(transfer.dof_indices_coarse.end(),
+                                       indices_coarse.begin(),
+                                       indices_coarse.end());
+
+    for(auto const i : indices_fine)
+      relevant_dofs_fine.add_index(i);
+
+    for(auto const i : indices_coarse)
+    {
+      relevant_dofs_coarse.add_index(i);
+
+      if(transfer.constraints_coarse->is_constrained(i))
+        for(auto const & entry : *transfer.constraints_coarse->get_constraint_entries(i))
+          relevant_dofs_coarse.add_index(entry.first);
+    }
+  }
+
+  relevant_dofs_fine.compress();
+  relevant_dofs_coarse.compress();
+
+  MPI_Comm const mpi_comm = matrixfree_fine.get_vector_partitioner()->get_mpi_communicator();
+
+  transfer.vector_fine.reinit(dof_handler_fine.locally_owned_mg_dofs(level_fine),
+                              relevant_dofs_fine,
+                              mpi_comm);
+  transfer.vector_coarse.reinit(dof_handler_coarse.locally_owned_mg_dofs(level_coarse),
+                                relevant_dofs_coarse,
+                                mpi_comm);
+
+  // weights are the inverse valence of a degree of freedom, i.e., the number of fine cells
+  // sharing a fine degree of freedom and the number of coarse cells sharing a coarse degree of
+  // freedom (every coarse cell is visited once per child in case of h-transfer)
+  Number const coarse_cell_fraction =
+    transfer.h_transfer ? 1.0 / dealii::GeometryInfo<dim>::max_children_per_cell : 1.0;
+
+  transfer.vector_fine   = 0.0;
+  transfer.vector_coarse = 0.0;
+
+  for(auto const i : transfer.dof_indices_fine)
+    transfer.vector_fine(i) += 1.0;
+  for(auto const i : transfer.dof_indices_coarse)
+    transfer.vector_coarse(i) += coarse_cell_fraction;
+
+  transfer.vector_fine.compress(dealii::VectorOperation::add);
+  transfer.vector_coarse.compress(dealii::VectorOperation::add);
+  transfer.vector_fine.update_ghost_values();
+  transfer.vector_coarse.update_ghost_values();
+
+  transfer.weights_fine.resize(transfer.dof_indices_fine.size());
+  for(unsigned int k = 0; k < transfer.dof_indices_fine.size(); ++k)
+    transfer.weights_fine[k] = 1.0 / transfer.vector_fine(transfer.dof_indices_fine[k]);
+
+  transfer.weights_coarse.resize(transfer.dof_indices_coarse.size());
+  for(unsigned int k = 0; k < transfer.dof_indices_coarse.size(); ++k)
+    transfer.weights_coarse[k] = 1.0 / transfer.vector_coarse(transfer.dof_indices_coarse[k]);
+
+  transfer.vector_fine.zero_out_ghost_values();
+  transfer.vector_coarse.zero_out_ghost_values();
+}
+
+template<int dim, typename Number, typename VectorType>
+void
+MGTransferHDIV<dim, Number, VectorType>::interpolate(unsigned int const level,
+                                                     VectorType &       dst,
+                                                     VectorType const & src) const
+{
+  LevelTransfer const & transfer = level_transfers[level];
+
+  unsigned int const dofs_per_cell_fine   = transfer.interpolation_matrices[0].n();
+  unsigned int const dofs_per_cell_coarse = transfer.interpolation_matrices[0].m();
+
+  transfer.vector_fine.copy_locally_owned_data_from(src);
+  transfer.vector_fine.update_ghost_values();
+  transfer.vector_coarse = 0.0;
+
+  dealii::Vector<double> values_fine(dofs_per_cell_fine);
+  dealii::Vector<double> values_coarse(dofs_per_cell_coarse);
+
+  for(unsigned int cell = 0; cell < transfer.matrix_index.size(); ++cell)
+  {
+    for(unsigned int j = 0; j < dofs_per_cell_fine; ++j)
+      values_fine[j] =
+        get_constrained_value(*transfer.constraints_fine,
+                              transfer.vector_fine,
+                              transfer.dof_indices_fine[cell * dofs_per_cell_fine + j]);
+
+    transfer.interpolation_matrices[transfer.matrix_index[cell]].vmult(values_coarse, values_fine);
+
+    for(unsigned int i = 0; i < dofs_per_cell_coarse; ++i)
+    {
+      unsigned int const k = cell * dofs_per_cell_coarse + i;
+      transfer.vector_coarse(transfer.dof_indices_coarse[k]) +=
+        transfer.weights_coarse[k] * values_coarse[i];
+    }
+  }
+
+  transfer.vector_coarse.compress(dealii::VectorOperation::add);
+  transfer.vector_fine.zero_out_ghost_values();
+
+  dst.copy_locally_owned_data_from(transfer.vector_coarse);
+}
+
+template<int dim, typename Number, typename VectorType>
+void
+MGTransferHDIV<dim, Number, VectorType>::restrict_and_add(unsigned int const level,
+                                                          VectorType &       dst,
+                                                          VectorType const & src) const
+{
+  LevelTransfer const & transfer = level_transfers[level];
+
+  unsigned int const dofs_per_cell_fine   = transfer.prolongation_matrices[0].m();
+  unsigned int const dofs_per_cell_coarse = transfer.prolongation_matrices[0].n();
+
+  transfer.vector_fine.copy_locally_owned_data_from(src);
+  transfer.vector_fine.update_ghost_values();
+  transfer.vector_coarse = 0.0;
+
+  dealii::Vector<double> values_fine(dofs_per_cell_fine);
+  dealii::Vector<double> values_coarse(dofs_per_cell_coarse);
+
+  for(unsigned int cell = 0; cell < transfer.matrix_index.size(); ++cell)
+  {
+    for(unsigned int j = 0; j < dofs_per_cell_fine; ++j)
+    {
+      unsigned int const                    k     = cell * dofs_per_cell_fine + j;
+      dealii::types::global_dof_index const index = transfer.dof_indices_fine[k];
+
+      values_fine[j] = transfer.constraints_fine->is_constrained(index) ?
+                         0.0 :
+                         transfer.weights_fine[k] * transfer.vector_fine(index);
+    }
+
+    transfer.prolongation_matrices[transfer.matrix_index[cell]].Tvmult(values_coarse, values_fine);
+
+    for(unsigned int i = 0; i < dofs_per_cell_coarse; ++i)
+      add_constrained_value(*transfer.constraints_coarse,
+                            transfer.vector_coarse,
+                            transfer.dof_indices_coarse[cell * dofs_per_cell_coarse + i],
+                            static_cast<Number>(values_coarse[i]));
+  }
+
+  transfer.vector_coarse.compress(dealii::VectorOperation::add);
+  transfer.vector_fine.zero_out_ghost_values();
+
+  add_locally_owned_part(dst, transfer.vector_coarse);
+}
+
+template<int dim, typename Number, typename VectorType>
+void
+MGTransferHDIV<dim, Number, VectorType>::prolongate_and_add(unsigned int const level,
+                                                            VectorType &       dst,
+                                                            VectorType const & src) const
+{
+  LevelTransfer const & transfer = level_transfers[level];
+
+  unsigned int const dofs_per_cell_fine   = transfer.prolongation_matrices[0].m();
+  unsigned int const dofs_per_cell_coarse = transfer.prolongation_matrices[0].n();
+
+  transfer.vector_coarse.copy_locally_owned_data_from(src);
+  transfer.vector_coarse.update_ghost_values();
+  transfer.vector_fine = 0.0;
+
+  dealii::Vector<double> values_fine(dofs_per_cell_fine);
+  dealii::Vector<double> values_coarse(dofs_per_cell_coarse);
+
+  for(unsigned int cell = 0; cell < transfer.matrix_index.size(); ++cell)
+  {
+    for(unsigned int i = 0; i < dofs_per_cell_coarse; ++i)
+      values_coarse[i] =
+        get_constrained_value(*transfer.constraints_coarse,
+                              transfer.vector_coarse,
+                              transfer.dof_indices_coarse[cell * dofs_per_cell_coarse + i]);
+
+    transfer.prolongation_matrices[transfer.matrix_index[cell]].vmult(values_fine, values_coarse);
+
+    for(unsigned int j = 0; j < dofs_per_cell_fine; ++j)
+    {
+      unsigned int const                    k     = cell * dofs_per_cell_fine + j;
+      dealii::types::global_dof_index const index = transfer.dof_indices_fine[k];
+
+      if(not(transfer.constraints_fine->is_constrained(index)))
+        transfer.vector_fine(index) += transfer.weights_fine[k] * values_fine[j];
+    }
+  }
+
+  transfer.vector_fine.compress(dealii::VectorOperation::add);
+  transfer.vector_coarse.zero_out_ghost_values();
+
+  add_locally_owned_part(dst, transfer.vector_fine);
+}
+
+typedef dealii::LinearAlgebra::distributed::Vector<float>  VectorTypeFloat;
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorTypeDouble;
+
+template class MGTransferHDIV<2, float, VectorTypeFloat>;
+
+template class MGTransferHDIV<3, float, VectorTypeFloat>;
+
+template class MGTransferHDIV<2, double, VectorTypeDouble>;
+
+template class MGTransferHDIV<3, double, VectorTypeDouble>;
+
+} // namespace ExaDG
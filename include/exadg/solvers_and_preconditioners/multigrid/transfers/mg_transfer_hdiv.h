@@ -0,0 +1,117 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef EXADG_MG_TRANSFER_HDIV_H
+#define EXADG_MG_TRANSFER_HDIV_H
+
+// deal.II
+#include <deal.II/base/mg_level_object.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/multigrid/transfers/mg_transfer.h>
+
+namespace ExaDG
+{
+/*
+ * Transfer operators for H(div)-conforming Raviart-Thomas elements (FE_RaviartThomasNodal) on a
+ * local smoothing multigrid hierarchy, i.e., all levels are defined on the same triangulation and
+ * either the mesh level (h-transfer) or the polynomial degree (p-transfer) changes between two
+ * consecutive levels.
+ *
+ * Since the tensor-product transfer kernels of MGTransferH/MGTransferP are restricted to
+ * FE_Q/FE_DGQ-type elements, the transfer is realized cell-by-cell with dense element matrices,
+ * i.e., the prolongation matrices of the finite element (h-transfer) or the embedding
+ * RT_{k-1} -> RT_{k} (p-transfer). Degrees of freedom shared between cells (normal components on
+ * faces) are weighted by the inverse of their valence. Constraints (periodicity, zero normal
+ * velocity) are resolved on the coarse level, and constrained degrees of freedom on the fine level
+ * are skipped.
+ */
+template<int dim, typename Number, typename VectorType>
+class MGTransferHDIV : virtual public MGTransfer<VectorType>
+{
+public:
+  virtual ~MGTransferHDIV()
+  {
+  }
+
+  void
+  reinit(dealii::MGLevelObject<std::shared_ptr<dealii::MatrixFree<dim, Number>>> & mg_matrixfree,
+         unsigned int const dof_handler_index = 0);
+
+  void
+  interpolate(unsigned int const level, VectorType & dst, VectorType const & src) const;
+
+  void
+  restrict_and_add(unsigned int const level, VectorType & dst, VectorType const & src) const;
+
+  void
+  prolongate_and_add(unsigned int const level, VectorType & dst, VectorType const & src) const;
+
+private:
+  /*
+   * Data needed for the transfer between a level and the next coarser level. All cell-wise data is
+   * stored for the locally owned cells of the fine level.
+   */
+  struct LevelTransfer
+  {
+    LevelTransfer() : h_transfer(false), constraints_fine(nullptr), constraints_coarse(nullptr)
+    {
+    }
+
+    bool h_transfer;
+
+    // one matrix per child for h-transfer, a single matrix for p-transfer
+    std::vector<dealii::FullMatrix<double>> prolongation_matrices;
+
+    // least-squares inverse of the prolongation used for interpolation
+    std::vector<dealii::FullMatrix<double>> interpolation_matrices;
+
+    std::vector<unsigned int> matrix_index;
+
+    std::vector<dealii::types::global_dof_index> dof_indices_fine;
+    std::vector<dealii::types::global_dof_index> dof_indices_coarse;
+
+    std::vector<Number> weights_fine;
+    std::vector<Number> weights_coarse;
+
+    dealii::AffineConstraints<Number> const * constraints_fine;
+    dealii::AffineConstraints<Number> const * constraints_coarse;
+
+    // ghosted vectors covering all degrees of freedom accessed by the cell loops
+    mutable VectorType vector_fine;
+    mutable VectorType vector_coarse;
+  };
+
+  void
+  reinit_level(LevelTransfer &                          transfer,
+               dealii::MatrixFree<dim, Number> const & matrixfree_fine,
+               dealii::MatrixFree<dim, Number> const & matrixfree_coarse,
+               unsigned int const                      dof_handler_index);
+
+  dealii::MGLevelObject<LevelTransfer> level_transfers;
+};
+
+} // namespace ExaDG
+
+#endif // EXADG_MG_TRANSFER_HDIV_H
@@ -19,6 +19,12 @@
  *  ______________________________________________________________________
  */
 
+// C/C++
+#include <map>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+
 // deal.II
 #include <deal.II/dofs/dof_tools.h>
 #include <deal.II/fe/fe_dgq.h>
@@ -97,6 +103,71 @@ fill_shape_values(dealii::AlignedVector<dealii::VectorizedArray<Number>> & shape
   convert_to_eo(shape_values_temp, shape_values, fe_degree_src, fe_degree_dst + 1);
 }
 
+/*
+ * The one-dimensional transfer matrices only depend on the pair of degrees. They are cached so
+ * that the projection matrices are not recomputed for every multigrid level, component, and
+ * transfer object using the same pair of degrees.
+ */
+template<typename Number>
+dealii::AlignedVector<dealii::VectorizedArray<Number>> const &
+get_shape_values(unsigned int fe_degree_src, unsigned int fe_degree_dst, bool do_transpose)
+{
+  static std::map<std::tuple<unsigned int, unsigned int, bool>,
+                  dealii::AlignedVector<dealii::VectorizedArray<Number>>>
+                    cache;
+  static std::mutex mutex;
+
+  std::lock_guard<std::mutex> lock(mutex);
+
+  dealii::AlignedVector<dealii::VectorizedArray<Number>> & shape_values =
+    cache[std::make_tuple(fe_degree_src, fe_degree_dst, do_transpose)];
+
+  if(shape_values.empty())
+    fill_shape_values(shape_values, fe_degree_src, fe_degree_dst, do_transpose);
+
+  return shape_values;
+}
+
+/*
+ * Maximal polynomial degree for which the transfer kernels are specialized at compile time.
+ */
+int const max_degree_p_transfer = 15;
+
+/*
+ * Compile-time table of all pairs of degrees 1 <= fe_degree_2 < fe_degree_1 <=
+ * max_degree_p_transfer. The function run() calls the functor with the pair (fe_degree_1,
+ * fe_degree_2) passed as std::integral_constant and returns false if the pair of degrees given at
+ * run time is not contained in the table.
+ */
+template<int fe_degree_1, int fe_degree_2 = 1>
+struct DegreePairTable
+{
+  template<typename Functor>
+  static bool
+  run(unsigned int const degree_1, unsigned int const degree_2, Functor const & functor)
+  {
+    if(degree_1 == fe_degree_1)
+    {
+      if(degree_2 == fe_degree_2)
+      {
+        functor(std::integral_constant<int, fe_degree_1>(),
+                std::integral_constant<int, fe_degree_2>());
+        return true;
+      }
+
+      if constexpr(fe_degree_2 + 1 < fe_degree_1)
+        return DegreePairTable<fe_degree_1, fe_degree_2 + 1>::run(degree_1, degree_2, functor);
+      else
+        return false;
+    }
+
+    if constexpr(fe_degree_2 == 1 && fe_degree_1 < max_degree_p_transfer)
+      return DegreePairTable<fe_degree_1 + 1, 1>::run(degree_1, degree_2, functor);
+    else
+      return false;
+  }
+};
+
 template<int dim, int points, int surface, typename Number, typename Number2>
 void
 loop_over_face_points(Number values, Number2 w)
@@ -356,8 +427,8 @@ MGTransferP<dim, Number, VectorType, components>::reinit(
 
   this->is_dg = matrixfree_1->get_dof_handler().get_fe().dofs_per_vertex == 0;
 
-  fill_shape_values(prolongation_matrix_1d, this->degree_2, this->degree_1, false);
-  fill_shape_values(interpolation_matrix_1d, this->degree_2, this->degree_1, true);
+  prolongation_matrix_1d  = get_shape_values<Number>(this->degree_2, this->degree_1, false);
+  interpolation_matrix_1d = get_shape_values<Number>(this->degree_2, this->degree_1, true);
 
   if(!is_dg)
   {
@@ -423,67 +494,15 @@ MGTransferP<dim, Number, VectorType, components>::interpolate(unsigned int const
   if(!this->is_dg) // only if CG
     src.update_ghost_values();
 
-  // clang-format off
-  switch(this->degree_1*100+this->degree_2)
-  {
-    // degree  2
-    case  201: do_interpolate< 2, 1>(dst, src); break;
-    // degree  3
-    case  301: do_interpolate< 3, 1>(dst, src); break;
-    case  302: do_interpolate< 3, 2>(dst, src); break;
-    // degree  4
-    case  401: do_interpolate< 4, 1>(dst, src); break;
-    case  402: do_interpolate< 4, 2>(dst, src); break;
-    case  403: do_interpolate< 4, 3>(dst, src); break;
-    // degree  5
-    case  501: do_interpolate< 5, 1>(dst, src); break;
-    case  502: do_interpolate< 5, 2>(dst, src); break;
-    case  504: do_interpolate< 5, 4>(dst, src); break;
-    // degree  6
-    case  601: do_interpolate< 6, 1>(dst, src); break;
-    case  603: do_interpolate< 6, 3>(dst, src); break;
-    case  605: do_interpolate< 6, 5>(dst, src); break;
-    // degree  7
-    case  701: do_interpolate< 7, 1>(dst, src); break;
-    case  703: do_interpolate< 7, 3>(dst, src); break;
-    case  706: do_interpolate< 7, 6>(dst, src); break;
-    // degree  8
-    case  801: do_interpolate< 8, 1>(dst, src); break;
-    case  804: do_interpolate< 8, 4>(dst, src); break;
-    case  807: do_interpolate< 8, 7>(dst, src); break;
-    // degree  9
-    case  901: do_interpolate< 9, 1>(dst, src); break;
-    case  904: do_interpolate< 9, 4>(dst, src); break;
-    case  908: do_interpolate< 9, 8>(dst, src); break;
-    // degree 10
-    case 1001: do_interpolate<10, 1>(dst, src); break;
-    case 1005: do_interpolate<10, 5>(dst, src); break;
-    case 1009: do_interpolate<10, 9>(dst, src); break;
-    // degree 11
-    case 1101: do_interpolate<11, 1>(dst, src); break;
-    case 1105: do_interpolate<11, 5>(dst, src); break;
-    case 1110: do_interpolate<11,10>(dst, src); break;
-    // degree 12
-    case 1201: do_interpolate<12, 1>(dst, src); break;
-    case 1206: do_interpolate<12, 6>(dst, src); break;
-    case 1211: do_interpolate<12,11>(dst, src); break;
-    // degree 13
-    case 1301: do_interpolate<13, 1>(dst, src); break;
-    case 1306: do_interpolate<13, 6>(dst, src); break;
-    case 1312: do_interpolate<13,12>(dst, src); break;
-    // degree 14
-    case 1401: do_interpolate<14, 1>(dst, src); break;
-    case 1407: do_interpolate<14, 7>(dst, src); break;
-    case 1413: do_interpolate<14,13>(dst, src); break;
-    // degree 15
-    case 1501: do_interpolate<15, 1>(dst, src); break;
-    case 1507: do_interpolate<15, 7>(dst, src); break;
-    case 1514: do_interpolate<15,14>(dst, src); break;
-    // error:
-    default:
-      AssertThrow(false, dealii::ExcMessage("MGTransferP::restrict_and_add() not implemented for this degree combination!"));
-  }
-  // clang-format on
+  auto const kernel = [&](auto k_1, auto k_2) {
+    this->template do_interpolate<decltype(k_1)::value, decltype(k_2)::value>(dst, src);
+  };
+
+  bool const pair_is_specialized = DegreePairTable<2>::run(this->degree_1, this->degree_2, kernel);
+
+  AssertThrow(pair_is_specialized,
+              dealii::ExcMessage("MGTransferP::interpolate() not implemented for this degree "
+                                 "combination!"));
 }
 
 template<int dim, typename Number, typename VectorType, int components>
@@ -495,67 +514,15 @@ MGTransferP<dim, Number, VectorType, components>::restrict_and_add(unsigned int
   if(!this->is_dg) // only if CG
     src.update_ghost_values();
 
-  // clang-format off
-  switch(this->degree_1*100+this->degree_2)
-  {
-    // degree  2
-    case  201: do_restrict_and_add< 2, 1>(dst, src); break;
-    // degree  3
-    case  301: do_restrict_and_add< 3, 1>(dst, src); break;
-    case  302: do_restrict_and_add< 3, 2>(dst, src); break;
-    // degree  4
-    case  401: do_restrict_and_add< 4, 1>(dst, src); break;
-    case  402: do_restrict_and_add< 4, 2>(dst, src); break;
-    case  403: do_restrict_and_add< 4, 3>(dst, src); break;
-    // degree  5
-    case  501: do_restrict_and_add< 5, 1>(dst, src); break;
-    case  502: do_restrict_and_add< 5, 2>(dst, src); break;
-    case  504: do_restrict_and_add< 5, 4>(dst, src); break;
-    // degree  6
-    case  601: do_restrict_and_add< 6, 1>(dst, src); break;
-    case  603: do_restrict_and_add< 6, 3>(dst, src); break;
-    case  605: do_restrict_and_add< 6, 5>(dst, src); break;
-    // degree  7
-    case  701: do_restrict_and_add< 7, 1>(dst, src); break;
-    case  703: do_restrict_and_add< 7, 3>(dst, src); break;
-    case  706: do_restrict_and_add< 7, 6>(dst, src); break;
-    // degree  8
-    case  801: do_restrict_and_add< 8, 1>(dst, src); break;
-    case  804: do_restrict_and_add< 8, 4>(dst, src); break;
-    case  807: do_restrict_and_add< 8, 7>(dst, src); break;
-    // degree  9
-    case  901: do_restrict_and_add< 9, 1>(dst, src); break;
-    case  904: do_restrict_and_add< 9, 4>(dst, src); break;
-    case  908: do_restrict_and_add< 9, 8>(dst, src); break;
-    // degree 10
-    case 1001: do_restrict_and_add<10, 1>(dst, src); break;
-    case 1005: do_restrict_and_add<10, 5>(dst, src); break;
-    case 1009: do_restrict_and_add<10, 9>(dst, src); break;
-    // degree 11
-    case 1101: do_restrict_and_add<11, 1>(dst, src); break;
-    case 1105: do_restrict_and_add<11, 5>(dst, src); break;
-    case 1110: do_restrict_and_add<11,10>(dst, src); break;
-    // degree 12
-    case 1201: do_restrict_and_add<12, 1>(dst, src); break;
-    case 1206: do_restrict_and_add<12, 6>(dst, src); break;
-    case 1211: do_restrict_and_add<12,11>(dst, src); break;
-    // degree 13
-    case 1301: do_restrict_and_add<13, 1>(dst, src); break;
-    case 1306: do_restrict_and_add<13, 6>(dst, src); break;
-    case 1312: do_restrict_and_add<13,12>(dst, src); break;
-    // degree 14
-    case 1401: do_restrict_and_add<14, 1>(dst, src); break;
-    case 1407: do_restrict_and_add<14, 7>(dst, src); break;
-    case 1413: do_restrict_and_add<14,13>(dst, src); break;
-    // degree 15
-    case 1501: do_restrict_and_add<15, 1>(dst, src); break;
-    case 1507: do_restrict_and_add<15, 7>(dst, src); break;
-    case 1514: do_restrict_and_add<15,14>(dst, src); break;
-    // error:
-    default:
-      AssertThrow(false, dealii::ExcMessage("MGTransferP::restrict_and_add() not implemented for this degree combination!"));
-  }
-  // clang-format on
+  auto const kernel = [&](auto k_1, auto k_2) {
+    this->template do_restrict_and_add<decltype(k_1)::value, decltype(k_2)::value>(dst, src);
+  };
+
+  bool const pair_is_specialized = DegreePairTable<2>::run(this->degree_1, this->degree_2, kernel);
+
+  AssertThrow(pair_is_specialized,
+              dealii::ExcMessage("MGTransferP::restrict_and_add() not implemented for this degree "
+                                 "combination!"));
 
   if(!this->is_dg) // only if CG
   {
@@ -575,67 +542,15 @@ MGTransferP<dim, Number, VectorType, components>::prolongate_and_add(unsigned in
     src.update_ghost_values();
   }
 
-  // clang-format off
-  switch(this->degree_1*100+this->degree_2)
-  {
-    // degree  2
-    case  201: do_prolongate< 2, 1>(dst, src); break;
-    // degree  3
-    case  301: do_prolongate< 3, 1>(dst, src); break;
-    case  302: do_prolongate< 3, 2>(dst, src); break;
-    // degree  4
-    case  401: do_prolongate< 4, 1>(dst, src); break;
-    case  402: do_prolongate< 4, 2>(dst, src); break;
-    case  403: do_prolongate< 4, 3>(dst, src); break;
-    // degree  5
-    case  501: do_prolongate< 5, 1>(dst, src); break;
-    case  502: do_prolongate< 5, 2>(dst, src); break;
-    case  504: do_prolongate< 5, 4>(dst, src); break;
-    // degree  6
-    case  601: do_prolongate< 6, 1>(dst, src); break;
-    case  603: do_prolongate< 6, 3>(dst, src); break;
-    case  605: do_prolongate< 6, 5>(dst, src); break;
-    // degree  7
-    case  701: do_prolongate< 7, 1>(dst, src); break;
-    case  703: do_prolongate< 7, 3>(dst, src); break;
-    case  706: do_prolongate< 7, 6>(dst, src); break;
-    // degree  8
-    case  801: do_prolongate< 8, 1>(dst, src); break;
-    case  804: do_prolongate< 8, 4>(dst, src); break;
-    case  807: do_prolongate< 8, 7>(dst, src); break;
-    // degree  9
-    case  901: do_prolongate< 9, 1>(dst, src); break;
-    case  904: do_prolongate< 9, 4>(dst, src); break;
-    case  908: do_prolongate< 9, 8>(dst, src); break;
-    // degree 10
-    case 1001: do_prolongate<10, 1>(dst, src); break;
-    case 1005: do_prolongate<10, 5>(dst, src); break;
-    case 1009: do_prolongate<10, 9>(dst, src); break;
-    // degree 11
-    case 1101: do_prolongate<11, 1>(dst, src); break;
-    case 1105: do_prolongate<11, 5>(dst, src); break;
-    case 1110: do_prolongate<11,10>(dst, src); break;
-    // degree 12
-    case 1201: do_prolongate<12, 1>(dst, src); break;
-    case 1206: do_prolongate<12, 6>(dst, src); break;
-    case 1211: do_prolongate<12,11>(dst, src); break;
-    // degree 13
-    case 1301: do_prolongate<13, 1>(dst, src); break;
-    case 1306: do_prolongate<13, 6>(dst, src); break;
-    case 1312: do_prolongate<13,12>(dst, src); break;
-    // degree 14
-    case 1401: do_prolongate<14, 1>(dst, src); break;
-    case 1407: do_prolongate<14, 7>(dst, src); break;
-    case 1413: do_prolongate<14,13>(dst, src); break;
-    // degree 15
-    case 1501: do_prolongate<15, 1>(dst, src); break;
-    case 1507: do_prolongate<15, 7>(dst, src); break;
-    case 1514: do_prolongate<15,14>(dst, src); break;
-    // error:
-    default:
-      AssertThrow(false, dealii::ExcMessage("MGTransferP::prolongate() not implemented for this degree combination!"));
-  }
-  // clang-format on
+  auto const kernel = [&](auto k_1, auto k_2) {
+    this->template do_prolongate<decltype(k_1)::value, decltype(k_2)::value>(dst, src);
+  };
+
+  bool const pair_is_specialized = DegreePairTable<2>::run(this->degree_1, this->degree_2, kernel);
+
+  AssertThrow(pair_is_specialized,
+              dealii::ExcMessage("MGTransferP::prolongate() not implemented for this degree "
+                                 "combination!"));
 
   if(!this->is_dg) // only if CG
   {
@@ -22,8 +22,12 @@
 #ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_NEWTON_SOLVER_H_
 #define INCLUDE_SOLVERS_AND_PRECONDITIONERS_NEWTON_SOLVER_H_
 
+// C/C++
+#include <cmath>
+
 // deal.II
 #include <deal.II/base/exceptions.h>
+#include <deal.II/base/types.h>
 
 // ExaDG
 #include <exadg/solvers_and_preconditioners/newton/newton_solver_data.h>
@@ -46,7 +50,8 @@ public:
     : solver_data(solver_data_in),
       nonlinear_operator(nonlinear_operator_in),
       linear_operator(linear_operator_in),
-      linear_solver(linear_solver_in)
+      linear_solver(linear_solver_in),
+      n_iter_linear_last(dealii::numbers::invalid_unsigned_int)
   {
   }
 
@@ -66,6 +71,10 @@ public:
     double norm_r   = residual.l2_norm();
     double norm_r_0 = norm_r;
 
+    // data of previous Newton iteration needed for Eisenstat-Walker forcing terms
+    double norm_r_old = norm_r;
+    double eta        = solver_data.eisenstat_walker_eta_max;
+
     while(norm_r > this->solver_data.abs_tol && norm_r / norm_r_0 > solver_data.rel_tol &&
           newton_iterations < solver_data.max_iter)
     {
@@ -79,21 +88,42 @@ public:
       linear_operator.set_solution_linearization(solution);
 
       // determine whether to update the operator/preconditioner of the linearized problem
-      bool const update_now =
+      bool update_now =
         update.do_update and (newton_iterations % update.update_every_newton_iter == 0);
 
+      // reuse the preconditioner as long as the linear solver converges fast enough
+      if(update_now and solver_data.reuse_preconditioner_max_linear_iter > 0 and
+         n_iter_linear_last != dealii::numbers::invalid_unsigned_int)
+      {
+        update_now = (n_iter_linear_last > solver_data.reuse_preconditioner_max_linear_iter);
+      }
+
       // update the preconditioner
       linear_solver.update_preconditioner(update_now);
 
+      // adapt the tolerance of the linear solver (inexact Newton method)
+      if(solver_data.use_eisenstat_walker)
+      {
+        if(newton_iterations > 0)
+          eta = compute_forcing_term(eta, norm_r, norm_r_old, norm_r_0);
+
+        linear_solver.set_relative_tolerance(eta);
+      }
+
       // solve linear problem
       unsigned int const n_iter_linear = linear_solver.solve(increment, residual);
 
-      // damped Newton scheme
-      double             omega         = 1.0; // damping factor (begin with 1)
-      double             norm_r_damp   = 1.0; // norm of residual using temporary solution
-      unsigned int       n_iter_damp   = 0;   // counts iteration of damping scheme
-      unsigned int const max_iter_damp = 10;  // max iterations of damping scheme
-      double const       tau           = 0.5; // a parameter (has to be smaller than 1)
+      n_iter_linear_last = n_iter_linear;
+
+      // The sufficient decrease condition of the line search accounts for the inexact solution of
+      // the linearized problem.
+      double const eta_line_search = solver_data.use_eisenstat_walker ? eta : 0.0;
+
+      // damped Newton scheme (backtracking line search)
+      double       omega       = 1.0; // damping factor (begin with 1)
+      double       norm_r_damp = 1.0; // norm of residual using temporary solution
+      unsigned int n_iter_damp = 0;   // counts iteration of damping scheme
+      bool         accepted    = false;
       do
       {
         // add increment to solution vector but scale by a factor omega <= 1
@@ -106,20 +136,28 @@ public:
         // calculate norm of residual (for temporary solution)
         norm_r_damp = residual.l2_norm();
 
-        // reduce step length
-        omega = omega / 2.0;
-
         // increment counter
         n_iter_damp++;
-      } while(norm_r_damp >= (1.0 - tau * omega) * norm_r && n_iter_damp < max_iter_damp);
 
-      AssertThrow(norm_r_damp < (1.0 - tau * omega) * norm_r,
+        accepted = std::isfinite(norm_r_damp) and
+                   norm_r_damp < (1.0 - solver_data.line_search_sufficient_decrease * omega *
+                                          (1.0 - eta_line_search)) *
+                                   norm_r;
+
+        // reduce step length
+        if(not accepted)
+          omega = reduce_step_length(omega, norm_r, norm_r_damp);
+
+      } while(not accepted && n_iter_damp < solver_data.max_iter_line_search);
+
+      AssertThrow(accepted,
                   dealii::ExcMessage("Damped Newton iteration did not converge. "
                                      "Maximum number of iterations exceeded!"));
 
       // update solution and residual
-      solution = temporary;
-      norm_r   = norm_r_damp;
+      solution   = temporary;
+      norm_r_old = norm_r;
+      norm_r     = norm_r_damp;
 
       // increment iteration counter
       ++newton_iterations;
@@ -143,10 +181,68 @@ public:
   }
 
 private:
+  /*
+   * Eisenstat-Walker forcing term (choice 2) including safeguards.
+   */
+  double
+  compute_forcing_term(double const eta_old,
+                       double const norm_r,
+                       double const norm_r_old,
+                       double const norm_r_0) const
+  {
+    double const gamma   = solver_data.eisenstat_walker_gamma;
+    double const alpha   = solver_data.eisenstat_walker_alpha;
+    double const eta_max = solver_data.eisenstat_walker_eta_max;
+
+    double eta = gamma * std::pow(norm_r / norm_r_old, alpha);
+
+    // safeguard to avoid that eta becomes too small too early
+    double const eta_safeguard = gamma * std::pow(eta_old, alpha);
+    if(eta_safeguard > 0.1)
+      eta = std::max(eta, eta_safeguard);
+
+    eta = std::min(eta, eta_max);
+
+    // avoid oversolving in the last Newton iteration
+    double const tol_newton = std::max(solver_data.abs_tol, solver_data.rel_tol * norm_r_0);
+    eta                     = std::max(eta, 0.5 * tol_newton / norm_r);
+
+    return std::min(eta, eta_max);
+  }
+
+  /*
+   * Computes the step length for the next iteration of the line search.
+   */
+  double
+  reduce_step_length(double const omega, double const norm_r, double const norm_r_damp) const
+  {
+    if(solver_data.line_search_quadratic_interpolation and std::isfinite(norm_r_damp))
+    {
+      // Minimize the quadratic polynomial p(omega) interpolating f = 1/2 |r|^2 with f(0), f'(0),
+      // and f(omega), where f'(0) = - |r|^2 for the Newton direction.
+      double const f_0     = 0.5 * norm_r * norm_r;
+      double const df_0    = -norm_r * norm_r;
+      double const f_omega = 0.5 * norm_r_damp * norm_r_damp;
+
+      double const denominator = 2.0 * (f_omega - f_0 - df_0 * omega);
+
+      double omega_new = (denominator > 0.0) ? -df_0 * omega * omega / denominator : 0.5 * omega;
+
+      return std::min(std::max(omega_new, 0.1 * omega), 0.5 * omega);
+    }
+    else
+    {
+      return 0.5 * omega;
+    }
+  }
+
   SolverData          solver_data;
   NonlinearOperator & nonlinear_operator;
   LinearOperator &    linear_operator;
   LinearSolver &      linear_solver;
+
+  // number of iterations of the last linear solve (used for reuse of preconditioner)
+  unsigned int n_iter_linear_last;
 };
 
 } // namespace Newton
@@ -34,13 +34,27 @@ namespace Newton
 {
 struct SolverData
 {
-  SolverData() : max_iter(100), abs_tol(1.e-12), rel_tol(1.e-12)
+  SolverData()
+    : max_iter(100),
+      abs_tol(1.e-12),
+      rel_tol(1.e-12),
+      use_eisenstat_walker(false),
+      eisenstat_walker_gamma(0.9),
+      eisenstat_walker_alpha(2.0),
+      eisenstat_walker_eta_max(0.1),
+      max_iter_line_search(10),
+      line_search_sufficient_decrease(0.25),
+      line_search_quadratic_interpolation(false),
+      reuse_preconditioner_max_linear_iter(0)
   {
   }
 
   SolverData(unsigned int const max_iter_, double const abs_tol_, double const rel_tol_)
-    : max_iter(max_iter_), abs_tol(abs_tol_), rel_tol(rel_tol_)
+    : SolverData()
   {
+    max_iter = max_iter_;
+    abs_tol  = abs_tol_;
+    rel_tol  = rel_tol_;
   }
 
   void
@@ -49,11 +63,67 @@ struct SolverData
     print_parameter(pcout, "Maximum number of iterations", max_iter);
     print_parameter(pcout, "Absolute solver tolerance", abs_tol);
     print_parameter(pcout, "Relative solver tolerance", rel_tol);
+
+    print_parameter(pcout, "Eisenstat-Walker forcing terms", use_eisenstat_walker);
+    if(use_eisenstat_walker)
+    {
+      print_parameter(pcout, "Eisenstat-Walker gamma", eisenstat_walker_gamma);
+      print_parameter(pcout, "Eisenstat-Walker alpha", eisenstat_walker_alpha);
+      print_parameter(pcout, "Eisenstat-Walker eta_max", eisenstat_walker_eta_max);
+    }
+
+    print_parameter(pcout, "Maximum number of line search iterations", max_iter_line_search);
+    print_parameter(pcout, "Line search sufficient decrease", line_search_sufficient_decrease);
+    print_parameter(pcout,
+                    "Line search quadratic interpolation",
+                    line_search_quadratic_interpolation);
+
+    if(reuse_preconditioner_max_linear_iter > 0)
+    {
+      print_parameter(pcout,
+                      "Reuse preconditioner (max. linear iter.)",
+                      reuse_preconditioner_max_linear_iter);
+    }
   }
 
   unsigned int max_iter;
   double       abs_tol;
   double       rel_tol;
+
+  /*
+   * Inexact Newton method: the relative tolerance eta_k of the linear solver is adapted in every
+   * Newton iteration according to Eisenstat and Walker (1996), choice 2,
+   *
+   *   eta_k = gamma * (|r_k| / |r_{k-1}|)^alpha ,
+   *
+   * safeguarded from above by eta_max and from below to avoid oversolving in the last Newton
+   * iteration. This avoids that the linearized problems are solved to a tolerance that is much
+   * smaller than required in early Newton iterations. The linear solver has to support
+   * Krylov::SolverBase::set_relative_tolerance().
+   */
+  bool   use_eisenstat_walker;
+  double eisenstat_walker_gamma;
+  double eisenstat_walker_alpha;
+  double eisenstat_walker_eta_max;
+
+  /*
+   * Backtracking line search on the norm of the nonlinear residual. A step length omega is
+   * accepted if |r(u + omega * du)| < (1 - c * omega * (1 - eta)) * |r(u)|, where c is the
+   * sufficient decrease parameter and eta the relative tolerance of the linear solver (eta = 0 if
+   * Eisenstat-Walker forcing terms are not used). The step length is halved in every iteration of
+   * the line search, or computed by minimizing a quadratic interpolation of |r|^2 (safeguarded to
+   * the interval [0.1, 0.5] * omega).
+   */
+  unsigned int max_iter_line_search;
+  double       line_search_sufficient_decrease;
+  bool         line_search_quadratic_interpolation;
+
+  /*
+   * Reuse of the preconditioner across Newton iterations: if a value larger than zero is
+   * specified, an update of the preconditioner (as prescribed by UpdateData) is only performed if
+   * the previous linear solve required more than this number of iterations.
+   */
+  unsigned int reuse_preconditioner_max_linear_iter;
 };
 
 struct UpdateData
@@ -23,10 +23,16 @@
 #define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_PRECONDITIONER_ELEMENTWISE_PRECONDITIONERS_H_
 
 // deal.II
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/lac/lapack_full_matrix.h>
+#include <deal.II/lac/vector.h>
 #include <deal.II/matrix_free/operators.h>
 
 // ExaDG
+#include <exadg/grid/enum_types.h>
 #include <exadg/matrix_free/integrators.h>
+#include <exadg/operators/interior_penalty_parameter.h>
 #include <exadg/solvers_and_preconditioners/solvers/elementwise_krylov_solvers.h>
 
 namespace ExaDG
@@ -124,6 +130,338 @@ private:
   std::shared_ptr<CellwiseInverseMass> inverse;
 };
 
+/*
+ * Coefficients of the separable approximation
+ *
+ *   mass_factor * M + diffusivity * L
+ *
+ * of the cell-local blocks of an operator, where M denotes the mass matrix and L the symmetric
+ * interior penalty Laplacian (with penalty factor IP_factor) restricted to one cell.
+ */
+struct TensorProductCoefficients
+{
+  TensorProductCoefficients() : mass_factor(0.0), diffusivity(0.0), IP_factor(1.0)
+  {
+  }
+
+  double mass_factor;
+  double diffusivity;
+  double IP_factor;
+};
+
+/*
+ * Fast diagonalization preconditioner for the cell-local problems of the block Jacobi
+ * preconditioner. On affine, axis-parallel cells, the matrix mass_factor * M + diffusivity * L
+ * has the Kronecker structure
+ *
+ *   sum_d M_{dim-1} x ... x B_d x ... x M_0 ,   B_d = diffusivity * L_d + mass_factor / dim * M_d ,
+ *
+ * so that its inverse can be applied as S (sum_d Lambda_d)^{-1} S^T with S = S_{dim-1} x ... x S_0
+ * by means of sum factorization, where B_d S_d = M_d S_d Lambda_d are the generalized eigenvalue
+ * problems of the one-dimensional matrices. Deformed cells are approximated by boxes with the cell
+ * extents computed from the Jacobian, and terms not contained in the above form (e.g. convective
+ * terms or penalty terms coupling the velocity components) are neglected.
+ *
+ * The eigendecompositions of all cell batches are computed in update() and stored in precision
+ * InnerNumber. Choosing InnerNumber = float with Number = double results in a mixed-precision
+ * variant, where the preconditioner data is kept in single precision while the elementwise Krylov
+ * solver computes residuals in double precision.
+ */
+template<int dim, int n_components, typename Number, typename InnerNumber = Number>
+class FastDiagonalizationPreconditioner
+  : public Elementwise::PreconditionerBase<dealii::VectorizedArray<Number>>
+{
+public:
+  typedef dealii::VectorizedArray<Number> VectorizedArrayType;
+
+  FastDiagonalizationPreconditioner(dealii::MatrixFree<dim, Number> const & matrix_free_in,
+                                    unsigned int const                      dof_index_in,
+                                    unsigned int const                      quad_index_in)
+    : matrix_free(matrix_free_in), dof_index(dof_index_in), quad_index(quad_index_in)
+  {
+    dealii::FiniteElement<dim> const & fe =
+      matrix_free.get_dof_handler(dof_index).get_fe().base_element(0);
+
+    AssertThrow(fe.get_name().find("FE_DGQ<") == 0,
+                dealii::ExcMessage("The fast diagonalization preconditioner is only implemented "
+                                   "for FE_DGQ elements."));
+
+    degree        = fe.degree;
+    n_rows_1d     = degree + 1;
+    dofs_per_comp = dealii::Utilities::pow(n_rows_1d, dim);
+
+    // one-dimensional reference matrices on the unit interval
+    dealii::FE_DGQ<1> const fe_1d(degree);
+    dealii::QGauss<1> const quadrature_1d(degree + 1);
+
+    mass_1d.reinit(n_rows_1d, n_rows_1d);
+    laplace_1d.reinit(n_rows_1d, n_rows_1d);
+    for(unsigned int i = 0; i < n_rows_1d; ++i)
+    {
+      for(unsigned int j = 0; j < n_rows_1d; ++j)
+      {
+        for(unsigned int q = 0; q < quadrature_1d.size(); ++q)
+        {
+          dealii::Point<1> const & x = quadrature_1d.point(q);
+
+          mass_1d(i, j) +=
+            fe_1d.shape_value(i, x) * fe_1d.shape_value(j, x) * quadrature_1d.weight(q);
+          laplace_1d(i, j) +=
+            fe_1d.shape_grad(i, x)[0] * fe_1d.shape_grad(j, x)[0] * quadrature_1d.weight(q);
+        }
+      }
+
+      values_left.push_back(fe_1d.shape_value(i, dealii::Point<1>(0.0)));
+      values_right.push_back(fe_1d.shape_value(i, dealii::Point<1>(1.0)));
+      gradients_left.push_back(fe_1d.shape_grad(i, dealii::Point<1>(0.0))[0]);
+      gradients_right.push_back(fe_1d.shape_grad(i, dealii::Point<1>(1.0))[0]);
+    }
+
+    eigenvectors.resize(dim * n_rows_1d * n_rows_1d);
+    inverse_eigenvalues.resize(dofs_per_comp);
+    temp.resize(2 * dofs_per_comp);
+  }
+
+  /*
+   * Computes the eigendecompositions for all cell batches with the current coefficients of the
+   * operator. Needs to be called whenever these coefficients or the mesh change.
+   */
+  void
+  update(TensorProductCoefficients const & coefficients)
+  {
+    AssertThrow(coefficients.mass_factor > 0.0 || coefficients.diffusivity > 0.0,
+                dealii::ExcMessage("The fast diagonalization preconditioner requires a positive "
+                                   "mass factor or a positive diffusivity."));
+
+    unsigned int const n       = n_rows_1d;
+    unsigned int const n_lanes = VectorizedArrayType::size();
+
+    unsigned int const n_cell_batches = matrix_free.n_cell_batches();
+
+    eigenvectors_storage.resize(index_eigenvectors(n_cell_batches, 0, 0, 0) * n_lanes);
+    inverse_eigenvalues_storage.resize(index_eigenvalues(n_cell_batches, 0) * n_lanes);
+
+    double const penalty_factor =
+      IP::get_penalty_factor<dim, double>(degree, ElementType::Hypercube, coefficients.IP_factor);
+
+    CellIntegrator<dim, n_components, Number> integrator(matrix_free, dof_index, quad_index);
+
+    std::array<std::vector<double>, dim> eigenvalues;
+    std::vector<dealii::Vector<double>>  eigenvectors_1d(n, dealii::Vector<double>(n));
+
+    for(unsigned int cell = 0; cell < n_cell_batches; ++cell)
+    {
+      integrator.reinit(cell);
+      dealii::Tensor<2, dim, VectorizedArrayType> const inverse_jacobian =
+        integrator.inverse_jacobian(0);
+
+      for(unsigned int v = 0; v < n_lanes; ++v)
+      {
+        // unused lanes are filled with the identity to avoid divisions by zero
+        bool const lane_is_active = v < matrix_free.n_active_entries_per_cell_batch(cell);
+
+        // cell extents in the coordinate directions
+        std::array<double, dim> h;
+        double                  surface_to_volume = 0.0;
+        for(unsigned int d = 0; d < dim; ++d)
+        {
+          double norm = 0.0;
+          for(unsigned int e = 0; e < dim; ++e)
+            norm += inverse_jacobian[d][e][v] * inverse_jacobian[d][e][v];
+          h[d] = lane_is_active ? 1.0 / std::sqrt(norm) : 1.0;
+          surface_to_volume += 1.0 / h[d];
+        }
+
+        double const tau = penalty_factor * surface_to_volume;
+
+        for(unsigned int d = 0; d < dim; ++d)
+        {
+          dealii::LAPACKFullMatrix<double> B(n, n), M(n, n);
+          for(unsigned int i = 0; i < n; ++i)
+          {
+            for(unsigned int j = 0; j < n; ++j)
+            {
+              M(i, j) = h[d] * mass_1d(i, j);
+
+              // cell integral and the contributions of the two faces of the cell in direction d
+              double const laplace =
+                laplace_1d(i, j) / h[d] + tau * (values_left[i] * values_left[j] +
+                                                 values_right[i] * values_right[j]) +
+                0.5 / h[d] *
+                  (gradients_left[i] * values_left[j] + values_left[i] * gradients_left[j]) -
+                0.5 / h[d] *
+                  (gradients_right[i] * values_right[j] + values_right[i] * gradients_right[j]);
+
+              B(i, j) =
+                coefficients.diffusivity * laplace + coefficients.mass_factor / dim * M(i, j);
+            }
+          }
+
+          if(lane_is_active)
+          {
+            // eigenvectors are normalized such that S_d^T M_d S_d = I
+            B.compute_generalized_eigenvalues_symmetric(M, eigenvectors_1d);
+
+            eigenvalues[d].resize(n);
+            for(unsigned int i = 0; i < n; ++i)
+            {
+              eigenvalues[d][i] = B.eigenvalue(i).real();
+              for(unsigned int j = 0; j < n; ++j)
+                eigenvectors_storage[index_eigenvectors(cell, d, j, i) * n_lanes + v] =
+                  eigenvectors_1d[i][j];
+            }
+          }
+          else
+          {
+            eigenvalues[d].assign(n, 1.0 / dim);
+            for(unsigned int i = 0; i < n; ++i)
+              for(unsigned int j = 0; j < n; ++j)
+                eigenvectors_storage[index_eigenvectors(cell, d, i, j) * n_lanes + v] =
+                  (i == j) ? 1.0 : 0.0;
+          }
+        }
+
+        // inverse of the eigenvalues of the tensor-product matrix (lexicographic numbering)
+        for(unsigned int i = 0; i < dofs_per_comp; ++i)
+        {
+          double       eigenvalue = 0.0;
+          unsigned int index      = i;
+          for(unsigned int d = 0; d < dim; ++d, index /= n)
+            eigenvalue += eigenvalues[d][index % n];
+
+          inverse_eigenvalues_storage[index_eigenvalues(cell, i) * n_lanes + v] = 1.0 / eigenvalue;
+        }
+      }
+    }
+  }
+
+  void
+  setup(unsigned int const cell)
+  {
+    AssertThrow(cell < matrix_free.n_cell_batches() && !eigenvectors_storage.empty(),
+                dealii::ExcMessage("Fast diagonalization preconditioner has not been updated."));
+
+    unsigned int const n       = n_rows_1d;
+    unsigned int const n_lanes = VectorizedArrayType::size();
+
+    // load data of current cell batch (and convert to Number in the mixed-precision case)
+    for(unsigned int d = 0; d < dim; ++d)
+      for(unsigned int i = 0; i < n; ++i)
+        for(unsigned int j = 0; j < n; ++j)
+          for(unsigned int v = 0; v < n_lanes; ++v)
+            eigenvectors[(d * n + i) * n + j][v] =
+              eigenvectors_storage[index_eigenvectors(cell, d, i, j) * n_lanes + v];
+
+    for(unsigned int i = 0; i < dofs_per_comp; ++i)
+      for(unsigned int v = 0; v < n_lanes; ++v)
+        inverse_eigenvalues[i][v] =
+          inverse_eigenvalues_storage[index_eigenvalues(cell, i) * n_lanes + v];
+  }
+
+  void
+  vmult(VectorizedArrayType * dst, VectorizedArrayType const * src) const
+  {
+    VectorizedArrayType * tmp_1 = temp.begin();
+    VectorizedArrayType * tmp_2 = temp.begin() + dofs_per_comp;
+
+    for(unsigned int c = 0; c < n_components; ++c)
+    {
+      VectorizedArrayType const * src_c = src + c * dofs_per_comp;
+      VectorizedArrayType *       dst_c = dst + c * dofs_per_comp;
+
+      // tmp = S^T * src
+      apply_1d<true>(0, src_c, tmp_1);
+      VectorizedArrayType * in  = tmp_1;
+      VectorizedArrayType * out = tmp_2;
+      for(unsigned int d = 1; d < dim; ++d)
+      {
+        apply_1d<true>(d, in, out);
+        std::swap(in, out);
+      }
+
+      // scale with inverse eigenvalues
+      for(unsigned int i = 0; i < dofs_per_comp; ++i)
+        in[i] *= inverse_eigenvalues[i];
+
+      // dst = S * tmp
+      for(unsigned int d = 0; d < dim; ++d)
+      {
+        apply_1d<false>(d, in, (d + 1 == dim) ? dst_c : out);
+        std::swap(in, out);
+      }
+    }
+  }
+
+private:
+  std::size_t
+  index_eigenvectors(unsigned int const cell,
+                     unsigned int const d,
+                     unsigned int const i,
+                     unsigned int const j) const
+  {
+    return ((std::size_t(cell) * dim + d) * n_rows_1d + i) * n_rows_1d + j;
+  }
+
+  std::size_t
+  index_eigenvalues(unsigned int const cell, unsigned int const i) const
+  {
+    return std::size_t(cell) * dofs_per_comp + i;
+  }
+
+  /*
+   * Applies the one-dimensional matrix S_d (or its transpose) in direction d.
+   */
+  template<bool transpose>
+  void
+  apply_1d(unsigned int const d, VectorizedArrayType const * in, VectorizedArrayType * out) const
+  {
+    unsigned int const n       = n_rows_1d;
+    unsigned int const stride  = dealii::Utilities::pow(n, d);
+    unsigned int const n_outer = dofs_per_comp / (stride * n);
+
+    VectorizedArrayType const * S = eigenvectors.begin() + d * n * n;
+
+    for(unsigned int outer = 0; outer < n_outer; ++outer)
+    {
+      for(unsigned int inner = 0; inner < stride; ++inner)
+      {
+        unsigned int const offset = outer * stride * n + inner;
+        for(unsigned int i = 0; i < n; ++i)
+        {
+          VectorizedArrayType sum = VectorizedArrayType();
+          for(unsigned int j = 0; j < n; ++j)
+            sum += (transpose ? S[j * n + i] : S[i * n + j]) * in[offset + j * stride];
+          out[offset + i * stride] = sum;
+        }
+      }
+    }
+  }
+
+  dealii::MatrixFree<dim, Number> const & matrix_free;
+
+  unsigned int const dof_index;
+  unsigned int const quad_index;
+
+  unsigned int degree;
+  unsigned int n_rows_1d;
+  unsigned int dofs_per_comp;
+
+  // one-dimensional reference matrices and values/gradients of the shape functions at the
+  // boundary of the unit interval
+  dealii::Table<2, double> mass_1d, laplace_1d;
+  std::vector<double>      values_left, values_right, gradients_left, gradients_right;
+
+  // eigenvectors and inverse eigenvalues of all cell batches with lanes stored contiguously
+  dealii::AlignedVector<InnerNumber> eigenvectors_storage;
+  dealii::AlignedVector<InnerNumber> inverse_eigenvalues_storage;
+
+  // data of the current cell batch
+  dealii::AlignedVector<VectorizedArrayType> eigenvectors;
+  dealii::AlignedVector<VectorizedArrayType> inverse_eigenvalues;
+
+  mutable dealii::AlignedVector<VectorizedArrayType> temp;
+};
+
 } // namespace Elementwise
 } // namespace ExaDG
 
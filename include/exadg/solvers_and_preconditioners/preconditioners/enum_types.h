@@ -36,7 +36,8 @@ enum class Preconditioner
 {
   Undefined,
   None,
-  InverseMassMatrix
+  InverseMassMatrix,
+  FastDiagonalization
 };
 
 } // namespace Elementwise
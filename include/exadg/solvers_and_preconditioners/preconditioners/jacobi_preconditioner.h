@@ -55,6 +55,10 @@ public:
   void
   update()
   {
+    // the degrees of freedom of the underlying operator might have changed, e.g., due to adaptive
+    // mesh refinement
+    underlying_operator.initialize_dof_vector(inverse_diagonal);
+
     underlying_operator.calculate_inverse_diagonal(inverse_diagonal);
   }
 
@@ -0,0 +1,372 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_PRECONDITIONERS_LOW_ORDER_REFINED_PRECONDITIONER_H_
+#define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_PRECONDITIONERS_LOW_ORDER_REFINED_PRECONDITIONER_H_
+
+// C/C++
+#include <array>
+
+// deal.II
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_tools.h>
+#include <deal.II/fe/mapping.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/dynamic_sparsity_pattern.h>
+#include <deal.II/lac/full_matrix.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/sparsity_tools.h>
+#include <deal.II/lac/trilinos_precondition.h>
+#include <deal.II/lac/trilinos_sparse_matrix.h>
+#include <deal.II/multigrid/mg_tools.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/preconditioner_base.h>
+
+namespace ExaDG
+{
+#ifdef DEAL_II_WITH_TRILINOS
+/*
+ * AMG preconditioner based on a low-order refined (LOR) discretization: every cell of a
+ * continuous FE_Q(k) discretization is subdivided into k^dim sub-cells whose vertices are the
+ * (Gauss-Lobatto) support points of FE_Q(k), and a Q1 Laplace matrix is assembled on these
+ * sub-cells. The LOR matrix has the same degrees of freedom as the high-order discretization but
+ * only couples degrees of freedom of neighboring support points, i.e., the sparse matrix is much
+ * cheaper to assemble and to set up AMG for. The LOR Laplace matrix is spectrally equivalent to
+ * the high-order Laplace matrix, so that it is a suitable preconditioner for the matrix-free
+ * high-order operator within a Krylov method, in particular for diffusion-dominated problems.
+ *
+ * The finite element has to be FE_Q or an FESystem of FE_Q, as used for the multigrid levels. For
+ * several components, the LOR Laplace matrix is assembled separately for every component.
+ *
+ * If level is set to a valid multigrid level, the level degrees of freedom are used, otherwise
+ * the active degrees of freedom.
+ */
+template<int dim, typename Number>
+class LowOrderRefinedAMGPreconditioner : public PreconditionerBase<Number>
+{
+private:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  typedef dealii::LinearAlgebra::distributed::Vector<double> VectorTypeAMG;
+
+public:
+  LowOrderRefinedAMGPreconditioner(dealii::DoFHandler<dim> const &           dof_handler,
+                                   dealii::Mapping<dim> const &              mapping,
+                                   dealii::AffineConstraints<Number> const & constraints,
+                                   unsigned int const                        level,
+                                   AMGData const &                           amg_data)
+    : dof_handler(dof_handler), mapping(mapping), level(level), amg_data(amg_data)
+  {
+    dealii::FiniteElement<dim> const & fe = dof_handler.get_fe();
+
+    AssertThrow(fe.n_base_elements() == 1 &&
+                  dynamic_cast<dealii::FE_Q<dim> const *>(&fe.base_element(0)) != nullptr,
+                dealii::ExcMessage("The low-order refined preconditioner requires FE_Q or an "
+                                   "FESystem of FE_Q."));
+
+    AssertThrow(amg_data.amg_type == AMGType::ML,
+                dealii::ExcMessage("The low-order refined preconditioner is only implemented "
+                                   "for AMGType::ML."));
+
+    constraints_double.copy_from(constraints);
+
+    initialize_lexicographic_numbering();
+
+    init_system_matrix();
+
+    // vectors in AMG precision used in vmult()
+    MPI_Comm const           mpi_comm = dof_handler.get_communicator();
+    dealii::IndexSet const & owned_dofs =
+      is_mg() ? dof_handler.locally_owned_mg_dofs(level) : dof_handler.locally_owned_dofs();
+    src_amg.reinit(owned_dofs, mpi_comm);
+    dst_amg.reinit(owned_dofs, mpi_comm);
+
+    calculate_system_matrix();
+
+    amg.initialize(system_matrix, amg_data.ml_data);
+  }
+
+  void
+  update() override
+  {
+    // the mesh might have moved, the sparsity pattern remains unchanged
+    system_matrix = 0.0;
+
+    calculate_system_matrix();
+
+    if(amg_data.reuse_coarsening_structure)
+      amg.reinit();
+    else
+      amg.initialize(system_matrix, amg_data.ml_data);
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const override
+  {
+    src_amg.copy_locally_owned_data_from(src);
+
+    amg.vmult(dst_amg, src_amg);
+
+    dst.copy_locally_owned_data_from(dst_amg);
+  }
+
+private:
+  bool
+  is_mg() const
+  {
+    return level != dealii::numbers::invalid_unsigned_int;
+  }
+
+  template<typename Function>
+  void
+  loop_over_locally_owned_cells(Function const & function) const
+  {
+    if(is_mg())
+    {
+      for(auto const & cell : dof_handler.mg_cell_iterators_on_level(level))
+        if(cell->is_locally_owned_on_level())
+          function(cell);
+    }
+    else
+    {
+      for(auto const & cell : dof_handler.active_cell_iterators())
+        if(cell->is_locally_owned())
+          function(cell);
+    }
+  }
+
+  /*
+   * Computes the cell-local (system) index of every support point of every component in
+   * lexicographic order, and the unit support points of the base element in lexicographic order.
+   */
+  void
+  initialize_lexicographic_numbering()
+  {
+    dealii::FiniteElement<dim> const & fe      = dof_handler.get_fe();
+    dealii::FiniteElement<dim> const & fe_base = fe.base_element(0);
+
+    degree = fe_base.degree;
+
+    std::vector<unsigned int> const lexicographic_to_hierarchic =
+      dealii::FETools::lexicographic_to_hierarchic_numbering<dim>(degree);
+
+    unit_support_points_lexicographic.resize(fe_base.dofs_per_cell);
+    for(unsigned int i = 0; i < fe_base.dofs_per_cell; ++i)
+      unit_support_points_lexicographic[i] =
+        fe_base.get_unit_support_points()[lexicographic_to_hierarchic[i]];
+
+    lexicographic_to_system.resize(fe.n_components(),
+                                   std::vector<unsigned int>(fe_base.dofs_per_cell));
+    for(unsigned int c = 0; c < fe.n_components(); ++c)
+      for(unsigned int i = 0; i < fe_base.dofs_per_cell; ++i)
+        lexicographic_to_system[c][i] =
+          fe.component_to_system_index(c, lexicographic_to_hierarchic[i]);
+  }
+
+  /*
+   * Returns the lexicographic index (within the base element) of vertex v of sub-cell s.
+   */
+  unsigned int
+  get_lexicographic_index(unsigned int const s, unsigned int const v) const
+  {
+    std::array<unsigned int, 3> sub_cell = {{0, 0, 0}};
+    for(unsigned int d = 0, rest = s; d < dim; ++d, rest /= degree)
+      sub_cell[d] = rest % degree;
+
+    unsigned int lexicographic = 0;
+    for(unsigned int d = 0, stride = 1; d < dim; ++d, stride *= degree + 1)
+      lexicographic += (sub_cell[d] + ((v >> d) & 1)) * stride;
+
+    return lexicographic;
+  }
+
+  /*
+   * Returns the degrees of freedom of all sub-cells of a cell for component c, ordered
+   * lexicographically within each sub-cell.
+   */
+  std::vector<std::vector<dealii::types::global_dof_index>>
+  get_sub_cell_dof_indices(std::vector<dealii::types::global_dof_index> const & cell_dof_indices,
+                           unsigned int const                                   c) const
+  {
+    unsigned int const n_vertices  = dealii::GeometryInfo<dim>::vertices_per_cell;
+    unsigned int const n_sub_cells = dealii::Utilities::pow(degree, dim);
+
+    std::vector<std::vector<dealii::types::global_dof_index>> sub_cell_dof_indices(
+      n_sub_cells, std::vector<dealii::types::global_dof_index>(n_vertices));
+
+    for(unsigned int s = 0; s < n_sub_cells; ++s)
+      for(unsigned int v = 0; v < n_vertices; ++v)
+        sub_cell_dof_indices[s][v] =
+          cell_dof_indices[lexicographic_to_system[c][get_lexicographic_index(s, v)]];
+
+    return sub_cell_dof_indices;
+  }
+
+  std::vector<dealii::types::global_dof_index>
+  get_dof_indices(typename dealii::DoFHandler<dim>::cell_iterator const & cell) const
+  {
+    std::vector<dealii::types::global_dof_index> dof_indices(dof_handler.get_fe().dofs_per_cell);
+    if(is_mg())
+      cell->get_mg_dof_indices(dof_indices);
+    else
+      cell->get_dof_indices(dof_indices);
+
+    return dof_indices;
+  }
+
+  void
+  init_system_matrix()
+  {
+    MPI_Comm const mpi_comm = dof_handler.get_communicator();
+
+    dealii::IndexSet const & owned_dofs =
+      is_mg() ? dof_handler.locally_owned_mg_dofs(level) : dof_handler.locally_owned_dofs();
+
+    dealii::IndexSet relevant_dofs;
+    if(is_mg())
+      dealii::DoFTools::extract_locally_relevant_level_dofs(dof_handler, level, relevant_dofs);
+    else
+      dealii::DoFTools::extract_locally_relevant_dofs(dof_handler, relevant_dofs);
+
+    // only degrees of freedom of the same sub-cell are coupled
+    dealii::DynamicSparsityPattern dsp(relevant_dofs);
+    loop_over_locally_owned_cells([&](auto const & cell) {
+      std::vector<dealii::types::global_dof_index> const cell_dof_indices = get_dof_indices(cell);
+      for(unsigned int c = 0; c < lexicographic_to_system.size(); ++c)
+        for(auto const & indices : get_sub_cell_dof_indices(cell_dof_indices, c))
+          constraints_double.add_entries_local_to_global(indices, dsp);
+    });
+
+    dealii::SparsityTools::distribute_sparsity_pattern(dsp, owned_dofs, mpi_comm, relevant_dofs);
+
+    system_matrix.reinit(owned_dofs, owned_dofs, dsp, mpi_comm);
+  }
+
+  /*
+   * Assembles the Q1 Laplace matrix on all sub-cells using a tensor-product Gauss quadrature
+   * with 2 points per direction. The sub-cells are mapped by the multilinear interpolation of
+   * their vertices.
+   */
+  void
+  calculate_system_matrix()
+  {
+    unsigned int const n_vertices = dealii::GeometryInfo<dim>::vertices_per_cell;
+
+    dealii::QGauss<dim> const quadrature(2);
+
+    // gradients of the Q1 shape functions in the quadrature points of the reference sub-cell
+    std::vector<std::vector<dealii::Tensor<1, dim>>> unit_gradients(
+      quadrature.size(), std::vector<dealii::Tensor<1, dim>>(n_vertices));
+    for(unsigned int q = 0; q < quadrature.size(); ++q)
+      for(unsigned int v = 0; v < n_vertices; ++v)
+        unit_gradients[q][v] =
+          dealii::GeometryInfo<dim>::d_linear_shape_function_gradient(quadrature.point(q), v);
+
+    unsigned int const n_sub_cells = dealii::Utilities::pow(degree, dim);
+
+    dealii::FullMatrix<double> sub_cell_matrix(n_vertices, n_vertices);
+
+    loop_over_locally_owned_cells([&](auto const & cell) {
+      std::vector<dealii::types::global_dof_index> const cell_dof_indices = get_dof_indices(cell);
+
+      // support points in real space (lexicographic numbering)
+      std::vector<dealii::Point<dim>> support_points(unit_support_points_lexicographic.size());
+      for(unsigned int i = 0; i < support_points.size(); ++i)
+        support_points[i] =
+          mapping.transform_unit_to_real_cell(cell, unit_support_points_lexicographic[i]);
+
+      std::vector<std::vector<std::vector<dealii::types::global_dof_index>>> sub_cell_dof_indices(
+        lexicographic_to_system.size());
+      for(unsigned int c = 0; c < lexicographic_to_system.size(); ++c)
+        sub_cell_dof_indices[c] = get_sub_cell_dof_indices(cell_dof_indices, c);
+
+      for(unsigned int s = 0; s < n_sub_cells; ++s)
+      {
+        std::vector<dealii::Point<dim>> vertices(n_vertices);
+        for(unsigned int v = 0; v < n_vertices; ++v)
+          vertices[v] = support_points[get_lexicographic_index(s, v)];
+
+        sub_cell_matrix = 0.0;
+        for(unsigned int q = 0; q < quadrature.size(); ++q)
+        {
+          dealii::Tensor<2, dim> jacobian;
+          for(unsigned int v = 0; v < n_vertices; ++v)
+            jacobian += dealii::outer_product(vertices[v], unit_gradients[q][v]);
+
+          double const JxW = determinant(jacobian) * quadrature.weight(q);
+
+          dealii::Tensor<2, dim> const inverse_jacobian_t = transpose(invert(jacobian));
+
+          std::vector<dealii::Tensor<1, dim>> gradients(n_vertices);
+          for(unsigned int v = 0; v < n_vertices; ++v)
+            gradients[v] = inverse_jacobian_t * unit_gradients[q][v];
+
+          for(unsigned int i = 0; i < n_vertices; ++i)
+            for(unsigned int j = 0; j < n_vertices; ++j)
+              sub_cell_matrix(i, j) += gradients[i] * gradients[j] * JxW;
+        }
+
+        // the components are not coupled
+        for(unsigned int c = 0; c < sub_cell_dof_indices.size(); ++c)
+          constraints_double.distribute_local_to_global(sub_cell_matrix,
+                                                        sub_cell_dof_indices[c][s],
+                                                        system_matrix);
+      }
+    });
+
+    system_matrix.compress(dealii::VectorOperation::add);
+  }
+
+  dealii::DoFHandler<dim> const & dof_handler;
+
+  dealii::Mapping<dim> const & mapping;
+
+  dealii::AffineConstraints<double> constraints_double;
+
+  unsigned int const level;
+
+  AMGData const amg_data;
+
+  unsigned int degree;
+
+  // unit support points of the base element in lexicographic order
+  std::vector<dealii::Point<dim>> unit_support_points_lexicographic;
+
+  // cell-local index of the lexicographic support points for every component
+  std::vector<std::vector<unsigned int>> lexicographic_to_system;
+
+  mutable VectorTypeAMG src_amg, dst_amg;
+
+  dealii::TrilinosWrappers::SparseMatrix system_matrix;
+
+  dealii::TrilinosWrappers::PreconditionAMG amg;
+};
+#endif
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_PRECONDITIONERS_LOW_ORDER_REFINED_PRECONDITIONER_H_ \
+        */
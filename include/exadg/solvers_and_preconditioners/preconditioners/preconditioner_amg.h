@@ -94,8 +94,10 @@ private:
   dealii::TrilinosWrappers::PreconditionAMG amg;
 
 public:
-  PreconditionerML(Operator const & op, MLData ml_data = MLData())
-    : pde_operator(op), ml_data(ml_data)
+  PreconditionerML(Operator const & op,
+                   MLData           ml_data                    = MLData(),
+                   bool const       reuse_coarsening_structure = false)
+    : pde_operator(op), ml_data(ml_data), reuse_coarsening_structure(reuse_coarsening_structure)
   {
     // initialize system matrix
     pde_operator.init_system_matrix(system_matrix,
@@ -124,7 +126,10 @@ public:
     pde_operator.calculate_system_matrix(system_matrix);
 
     // initialize Trilinos' AMG
-    amg.initialize(system_matrix, ml_data);
+    if(reuse_coarsening_structure)
+      amg.reinit();
+    else
+      amg.initialize(system_matrix, ml_data);
   }
 
   void
@@ -138,6 +143,8 @@ private:
   Operator const & pde_operator;
 
   MLData ml_data;
+
+  bool const reuse_coarsening_structure;
 };
 #endif
 
@@ -286,7 +293,9 @@ public:
     {
 #ifdef DEAL_II_WITH_TRILINOS
       preconditioner_amg =
-        std::make_shared<PreconditionerML<Operator, double>>(pde_operator, data.ml_data);
+        std::make_shared<PreconditionerML<Operator, double>>(pde_operator,
+                                                             data.ml_data,
+                                                             data.reuse_coarsening_structure);
 #else
       AssertThrow(false, dealii::ExcMessage("deal.II is not compiled with Trilinos!"));
 #endif
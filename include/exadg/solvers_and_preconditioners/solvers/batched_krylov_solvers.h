@@ -0,0 +1,268 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_BATCHED_KRYLOV_SOLVERS_H_
+#define INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_BATCHED_KRYLOV_SOLVERS_H_
+
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/timer.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
+
+namespace ExaDG
+{
+namespace Krylov
+{
+/*
+ * Preconditioned CG method for several independent linear systems A x_b = b_b with the same
+ * operator A, where the solutions and right-hand sides are stored as blocks of a block vector. The
+ * CG iterations of all systems are performed in lockstep with separate step lengths and search
+ * directions for each block, so that the result is identical to separate CG solves. However,
+ * the operator is applied to all blocks within one loop over the mesh (see
+ * OperatorBase::apply_batched()) and the inner products of all blocks are combined, so that each
+ * iteration performs two global reductions independently of the number of blocks: one for p^T A p
+ * and one for the residual norms together with r^T z. Blocks that have converged are excluded
+ * from further updates.
+ *
+ * The operator needs to provide apply_batched(BlockVectorType &, BlockVectorType const &), the
+ * preconditioner is applied block by block via vmult(VectorType &, VectorType const &).
+ */
+template<typename Operator, typename Preconditioner, typename BlockVectorType>
+class SolverCGBatched : public SolverBase<BlockVectorType>
+{
+public:
+  SolverCGBatched(Operator const &     underlying_operator_in,
+                  Preconditioner &     preconditioner_in,
+                  SolverDataCG const & solver_data_in)
+    : underlying_operator(underlying_operator_in),
+      preconditioner(preconditioner_in),
+      solver_data(solver_data_in)
+  {
+  }
+
+  void
+  update_preconditioner(bool const update_preconditioner) const override
+  {
+    if(solver_data.use_preconditioner and update_preconditioner)
+    {
+      preconditioner.update();
+    }
+  }
+
+  void
+  set_relative_tolerance(double const relative_tolerance) override
+  {
+    solver_data.solver_tolerance_rel = relative_tolerance;
+  }
+
+  /*
+   * Returns the maximum number of iterations over all blocks.
+   */
+  unsigned int
+  solve(BlockVectorType & dst, BlockVectorType const & rhs) const override
+  {
+    dealii::Timer timer;
+
+    unsigned int const n_blocks = rhs.n_blocks();
+
+    AssertThrow(n_blocks > 0, dealii::ExcMessage("Block vector rhs has no blocks."));
+
+    MPI_Comm const mpi_comm = rhs.block(0).get_mpi_communicator();
+
+    BlockVectorType r, z, p, v;
+    r.reinit(rhs, true);
+    z.reinit(rhs, true);
+    p.reinit(rhs, true);
+    v.reinit(rhs, true);
+
+    // initial residual r = b - A x
+    underlying_operator.apply_batched(r, dst);
+    r.sadd(-1.0, 1.0, rhs);
+
+    std::vector<bool> active(n_blocks, true);
+
+    apply_preconditioner(z, r, active);
+
+    std::vector<double> residual_norm, r_dot_z;
+    compute_norms_and_inner_products(residual_norm, r_dot_z, r, z, mpi_comm);
+
+    std::vector<double> tolerance(n_blocks);
+    for(unsigned int b = 0; b < n_blocks; ++b)
+    {
+      tolerance[b] = std::max(solver_data.solver_tolerance_abs,
+                              solver_data.solver_tolerance_rel * residual_norm[b]);
+      active[b]    = residual_norm[b] > tolerance[b];
+    }
+
+    // search directions of converged blocks are zero, so that these blocks are not modified
+    for(unsigned int b = 0; b < n_blocks; ++b)
+    {
+      if(active[b])
+        p.block(b) = z.block(b);
+      else
+        p.block(b) = 0.0;
+    }
+
+    unsigned int n_iter = 0;
+    while(std::any_of(active.begin(), active.end(), [](bool const a) { return a; }) and
+          n_iter < solver_data.max_iter)
+    {
+      underlying_operator.apply_batched(v, p);
+
+      std::vector<double> const p_dot_v = compute_inner_products(p, v, mpi_comm);
+
+      for(unsigned int b = 0; b < n_blocks; ++b)
+      {
+        if(active[b])
+        {
+          double const alpha = r_dot_z[b] / p_dot_v[b];
+          dst.block(b).add(alpha, p.block(b));
+          r.block(b).add(-alpha, v.block(b));
+        }
+      }
+
+      ++n_iter;
+
+      // The preconditioner is applied before the convergence check, so that the residual norm
+      // and r^T z are obtained with one global reduction. This costs one unnecessary
+      // preconditioner application for blocks that converge in this iteration.
+      apply_preconditioner(z, r, active);
+
+      std::vector<double> r_dot_z_new;
+      compute_norms_and_inner_products(residual_norm, r_dot_z_new, r, z, mpi_comm);
+
+      for(unsigned int b = 0; b < n_blocks; ++b)
+      {
+        if(not(active[b]))
+          continue;
+
+        AssertThrow(std::isfinite(residual_norm[b]),
+                    dealii::ExcMessage("Solver contained NaN of Inf values"));
+
+        if(residual_norm[b] <= tolerance[b])
+        {
+          active[b]  = false;
+          p.block(b) = 0.0;
+        }
+        else
+        {
+          double const beta = r_dot_z_new[b] / r_dot_z[b];
+          p.block(b).sadd(beta, 1.0, z.block(b));
+          r_dot_z[b] = r_dot_z_new[b];
+        }
+      }
+    }
+
+    AssertThrow(std::none_of(active.begin(), active.end(), [](bool const a) { return a; }),
+                dealii::ExcMessage("SolverCGBatched did not converge within the maximum number "
+                                   "of iterations."));
+
+    this->timer_tree->insert({"SolverCGBatched"}, timer.wall_time());
+
+    return n_iter;
+  }
+
+private:
+  void
+  apply_preconditioner(BlockVectorType &         dst,
+                       BlockVectorType const &   src,
+                       std::vector<bool> const & active) const
+  {
+    for(unsigned int b = 0; b < src.n_blocks(); ++b)
+    {
+      if(not(active[b]))
+        dst.block(b) = 0.0;
+      else if(solver_data.use_preconditioner)
+        preconditioner.vmult(dst.block(b), src.block(b));
+      else
+        dst.block(b) = src.block(b);
+    }
+  }
+
+  // one global reduction for the inner products of all blocks
+  static std::vector<double>
+  compute_inner_products(BlockVectorType const & a,
+                         BlockVectorType const & b,
+                         MPI_Comm const &        mpi_comm)
+  {
+    std::vector<double> local(a.n_blocks(), 0.0);
+    for(unsigned int k = 0; k < a.n_blocks(); ++k)
+    {
+      for(unsigned int i = 0; i < a.block(k).locally_owned_size(); ++i)
+        local[k] += a.block(k).local_element(i) * b.block(k).local_element(i);
+    }
+
+    std::vector<double> global(a.n_blocks(), 0.0);
+    dealii::Utilities::MPI::sum(local, mpi_comm, global);
+
+    return global;
+  }
+
+  // one global reduction for the residual norms and the inner products r^T z of all blocks
+  static void
+  compute_norms_and_inner_products(std::vector<double> &   r_norm,
+                                   std::vector<double> &   r_dot_z,
+                                   BlockVectorType const & r,
+                                   BlockVectorType const & z,
+                                   MPI_Comm const &        mpi_comm)
+  {
+    unsigned int const n_blocks = r.n_blocks();
+
+    std::vector<double> local(2 * n_blocks, 0.0);
+    for(unsigned int k = 0; k < n_blocks; ++k)
+    {
+      for(unsigned int i = 0; i < r.block(k).locally_owned_size(); ++i)
+      {
+        local[k] += r.block(k).local_element(i) * r.block(k).local_element(i);
+        local[n_blocks + k] += r.block(k).local_element(i) * z.block(k).local_element(i);
+      }
+    }
+
+    std::vector<double> global(2 * n_blocks, 0.0);
+    dealii::Utilities::MPI::sum(local, mpi_comm, global);
+
+    r_norm.resize(n_blocks);
+    r_dot_z.resize(n_blocks);
+    for(unsigned int k = 0; k < n_blocks; ++k)
+    {
+      r_norm[k]  = std::sqrt(global[k]);
+      r_dot_z[k] = global[n_blocks + k];
+    }
+  }
+
+  Operator const & underlying_operator;
+
+  Preconditioner & preconditioner;
+
+  SolverDataCG solver_data;
+};
+
+} // namespace Krylov
+} // namespace ExaDG
+
+#endif /* INCLUDE_EXADG_SOLVERS_AND_PRECONDITIONERS_SOLVERS_BATCHED_KRYLOV_SOLVERS_H_ */
@@ -113,6 +113,29 @@ converged(dealii::VectorizedArray<Number> & is_converged,
   return all_true(is_converged);
 }
 
+/*
+ * Sets x to zero for those components of the vectorized array for which the iterative solver has
+ * already converged (positive convergence status). Used to freeze converged lanes, i.e., the
+ * solution of a converged lane is no longer modified while the solver iterates on the other lanes.
+ */
+template<typename Number>
+void
+mask_converged(Number & x, Number const is_converged)
+{
+  if(is_converged > 0.0)
+    x = 0.0;
+}
+
+template<typename Number>
+void
+mask_converged(dealii::VectorizedArray<Number> &     x,
+               dealii::VectorizedArray<Number> const is_converged)
+{
+  for(unsigned int v = 0; v < dealii::VectorizedArray<Number>::size(); ++v)
+    if(is_converged[v] > 0.0)
+      x[v] = 0.0;
+}
+
 template<typename Number>
 void
 adjust_division_by_zero(Number &)
@@ -296,6 +319,15 @@ SolverCG<value_type, Matrix, Preconditioner>::solve(Matrix const *         matri
 
   unsigned int n_iter = 0;
 
+  // convergence status of the individual lanes of a vectorized array (negative values = not
+  // converged), which allows to terminate the iteration lane by lane
+  value_type convergence_status = -one;
+  if(converged(
+       convergence_status, norm_r_abs, ABS_TOL, norm_r_rel, REL_TOL, n_iter, MAX_ITER + 1))
+  {
+    return;
+  }
+
   while(true)
   {
     // v = A*p
@@ -308,6 +340,9 @@ SolverCG<value_type, Matrix, Preconditioner>::solve(Matrix const *         matri
     // alpha = (r^T*y) / (p^T*v)
     value_type alpha = (r_times_y) / (p_times_v);
 
+    // lanes that have already converged are not updated any more
+    mask_converged(alpha, convergence_status);
+
     // solution <- solution + alpha*p
     add(solution, alpha, p, M);
 
@@ -321,8 +356,9 @@ SolverCG<value_type, Matrix, Preconditioner>::solve(Matrix const *         matri
     // increment iteration counter
     ++n_iter;
 
-    // check convergence
-    if(all_smaller(norm_r_abs, ABS_TOL) || all_smaller(norm_r_rel, REL_TOL) || (n_iter > MAX_ITER))
+    // check convergence (for each lane separately and terminate once all lanes have converged)
+    if(converged(
+         convergence_status, norm_r_abs, ABS_TOL, norm_r_rel, REL_TOL, n_iter, MAX_ITER + 1))
     {
       break;
     }
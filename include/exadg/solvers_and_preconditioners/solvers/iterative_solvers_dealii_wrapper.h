@@ -22,7 +22,11 @@
 #ifndef INCLUDE_SOLVERS_AND_PRECONDITIONERS_ITERATIVESOLVERS_H_
 #define INCLUDE_SOLVERS_AND_PRECONDITIONERS_ITERATIVESOLVERS_H_
 
+// C/C++
+#include <array>
+
 // deal.II
+#include <deal.II/base/mpi.h>
 #include <deal.II/base/timer.h>
 #include <deal.II/lac/precondition.h>
 #include <deal.II/lac/solver_cg.h>
@@ -54,6 +58,20 @@ public:
   virtual void
   update_preconditioner(bool const update_preconditioner) const = 0;
 
+  /*
+   * Changes the relative tolerance of the solver, e.g., to realize adaptive forcing terms when
+   * used as linear solver within an inexact Newton method.
+   */
+  virtual void
+  set_relative_tolerance(double const relative_tolerance)
+  {
+    (void)relative_tolerance;
+
+    AssertThrow(false,
+                dealii::ExcMessage(
+                  "Function set_relative_tolerance() is not implemented for this solver."));
+  }
+
   template<typename Control>
   void
   compute_performance_metrics(Control const & solver_control) const
@@ -128,6 +146,12 @@ public:
     }
   }
 
+  void
+  set_relative_tolerance(double const relative_tolerance) override
+  {
+    solver_data.solver_tolerance_rel = relative_tolerance;
+  }
+
   unsigned int
   solve(VectorType & dst, VectorType const & rhs) const override
   {
@@ -169,9 +193,371 @@ public:
   }
 
 private:
-  Operator const &   underlying_operator;
-  Preconditioner &   preconditioner;
-  SolverDataCG const solver_data;
+  Operator const & underlying_operator;
+  Preconditioner & preconditioner;
+  SolverDataCG     solver_data;
+};
+
+/*
+ * Preconditioned conjugate gradient method with vector operations fused into the operator
+ * evaluation. The operator has to provide a function
+ *
+ *   vmult(dst, src, operation_before_loop, operation_after_loop)
+ *
+ * that calls operation_before_loop(begin, end) on a range of locally owned vector entries before
+ * the operator evaluation reads these entries, and operation_after_loop(begin, end) once the
+ * operator evaluation has finished writing into them (see OperatorBase::vmult()). The update of
+ * the search direction p = z + beta * p and the (delayed) update of the solution x += alpha * p
+ * are done before the loop, and the inner product (p, A p) is computed after the loop, so that
+ * these operations work on vector entries that are in cache. The update of the residual and the
+ * inner products (r, z) and (r, r) are combined into a single vector sweep if no preconditioner
+ * is used (and two vector sweeps around the preconditioner application otherwise), with a single
+ * global reduction.
+ *
+ * The method is mathematically equivalent to SolverCG.
+ */
+template<typename Operator, typename Preconditioner, typename VectorType>
+class SolverFusedCG : public SolverBase<VectorType>
+{
+public:
+  SolverFusedCG(Operator const &     underlying_operator_in,
+                Preconditioner &     preconditioner_in,
+                SolverDataCG const & solver_data_in)
+    : underlying_operator(underlying_operator_in),
+      preconditioner(preconditioner_in),
+      solver_data(solver_data_in)
+  {
+  }
+
+  void
+  update_preconditioner(bool const update_preconditioner) const override
+  {
+    if(solver_data.use_preconditioner and update_preconditioner)
+    {
+      preconditioner.update();
+    }
+  }
+
+  void
+  set_relative_tolerance(double const relative_tolerance) override
+  {
+    solver_data.solver_tolerance_rel = relative_tolerance;
+  }
+
+  unsigned int
+  solve(VectorType & dst, VectorType const & rhs) const override
+  {
+    dealii::Timer timer;
+
+    dealii::ReductionControl solver_control(solver_data.max_iter,
+                                            solver_data.solver_tolerance_abs,
+                                            solver_data.solver_tolerance_rel);
+
+    MPI_Comm const mpi_comm = rhs.get_mpi_communicator();
+
+    // r and z are overwritten before they are read. In contrast, p and Ap enter the first
+    // iteration multiplied by alpha = beta = 0 and have to be zero-initialized, since 0 * NaN
+    // would result in NaN otherwise.
+    VectorType r, z, p, Ap;
+    for(VectorType * vector : {&r, &z})
+      vector->reinit(rhs, true);
+    for(VectorType * vector : {&p, &Ap})
+      vector->reinit(rhs);
+
+    // r = b - A x
+    underlying_operator.vmult(r, dst);
+    r.sadd(-1.0, 1.0, rhs);
+
+    double r_times_z = 0.0, alpha = 0.0, beta = 0.0;
+
+    // r -= alpha * A p, z = M^{-1} r, and inner products (r, z), (r, r)
+    auto const update_residual_and_compute_inner_products = [&]() {
+      std::array<double, 2> sums = {{0.0, 0.0}};
+      if(solver_data.use_preconditioner)
+      {
+        r.add(-alpha, Ap);
+        preconditioner.vmult(z, r);
+        for(unsigned int i = 0; i < r.locally_owned_size(); ++i)
+        {
+          sums[0] += r.local_element(i) * z.local_element(i);
+          sums[1] += r.local_element(i) * r.local_element(i);
+        }
+      }
+      else
+      {
+        for(unsigned int i = 0; i < r.locally_owned_size(); ++i)
+        {
+          r.local_element(i) -= alpha * Ap.local_element(i);
+          sums[1] += r.local_element(i) * r.local_element(i);
+        }
+        sums[0] = sums[1];
+      }
+
+      dealii::Utilities::MPI::sum(dealii::ArrayView<double const>(sums.data(), sums.size()),
+                                  mpi_comm,
+                                  dealii::ArrayView<double>(sums.data(), sums.size()));
+
+      return sums;
+    };
+
+    // Ap = 0 and alpha = 0 in the first call
+    std::array<double, 2> sums = update_residual_and_compute_inner_products();
+    r_times_z                  = sums[0];
+
+    dealii::SolverControl::State state = solver_control.check(0, std::sqrt(sums[1]));
+
+    // without preconditioner, z = r
+    VectorType const & z_or_r = solver_data.use_preconditioner ? z : r;
+
+    double p_times_Ap = 0.0;
+
+    auto const operation_before_loop = [&](unsigned int const begin, unsigned int const end) {
+      for(unsigned int i = begin; i < end; ++i)
+      {
+        // delayed update of the solution from the previous iteration
+        dst.local_element(i) += alpha * p.local_element(i);
+        p.local_element(i) = z_or_r.local_element(i) + beta * p.local_element(i);
+      }
+    };
+
+    auto const operation_after_loop = [&](unsigned int const begin, unsigned int const end) {
+      for(unsigned int i = begin; i < end; ++i)
+        p_times_Ap += p.local_element(i) * Ap.local_element(i);
+    };
+
+    for(unsigned int k = 1; state == dealii::SolverControl::iterate; ++k)
+    {
+      p_times_Ap = 0.0;
+      underlying_operator.vmult(Ap, p, operation_before_loop, operation_after_loop);
+      p_times_Ap = dealii::Utilities::MPI::sum(p_times_Ap, mpi_comm);
+
+      alpha = r_times_z / p_times_Ap;
+
+      sums  = update_residual_and_compute_inner_products();
+      beta  = sums[0] / r_times_z;
+      state = solver_control.check(k, std::sqrt(sums[1]));
+
+      r_times_z = sums[0];
+    }
+
+    // the update of the solution of the last iteration has not been done yet
+    dst.add(alpha, p);
+
+    AssertThrow(state == dealii::SolverControl::success,
+                dealii::SolverControl::NoConvergence(solver_control.last_step(),
+                                                     solver_control.last_value()));
+
+    if(solver_data.compute_performance_metrics)
+      this->compute_performance_metrics(solver_control);
+
+    this->timer_tree->insert({"SolverFusedCG"}, timer.wall_time());
+
+    return solver_control.last_step();
+  }
+
+  std::shared_ptr<TimerTree>
+  get_timings() const override
+  {
+    if(solver_data.use_preconditioner)
+      this->timer_tree->insert({"SolverFusedCG"}, preconditioner.get_timings());
+
+    return this->timer_tree;
+  }
+
+private:
+  Operator const & underlying_operator;
+  Preconditioner & preconditioner;
+  SolverDataCG     solver_data;
+};
+
+/*
+ * Preconditioned pipelined conjugate gradient method according to
+ *
+ *   Ghysels, Vanroose (2014), "Hiding global synchronization latency in the preconditioned
+ *   Conjugate Gradient algorithm", Parallel Computing 40(7), pp. 224-238.
+ *
+ * Mathematically, the method is equivalent to the standard preconditioned CG method. The three
+ * inner products of one iteration (including the residual norm used for the convergence check)
+ * are combined into a single global reduction. This reduction is started with a non-blocking
+ * MPI_Iallreduce and is overlapped with the application of the preconditioner and the operator.
+ * The price is a higher number of vector updates (and 9 instead of 4 auxiliary vectors), and a
+ * slightly reduced attainable accuracy due to the recurrences. Hence, this solver is beneficial
+ * if the global reductions dominate the cost of an iteration, i.e., for large numbers of MPI
+ * ranks and cheap operators/preconditioners. Note that the convergence check is only available
+ * after the reduction has been completed, i.e., the solver performs one additional application
+ * of the preconditioner and the operator compared to the standard CG method.
+ *
+ * The vectors r = b - A x, u = M^{-1} r, w = A u, s = A p, q = M^{-1} s, and z = A q are updated
+ * by recurrences. Rounding errors accumulate in these recurrences, so that r drifts away from the
+ * true residual, which can prevent convergence for ill-conditioned problems. Therefore, these
+ * vectors are recomputed from their definitions every residual_replacement_interval iterations
+ * (residual replacement) at the cost of four operator and two preconditioner applications.
+ *
+ * Note that the overlap of communication and computation relies on asynchronous progress of the
+ * MPI implementation.
+ */
+template<typename Operator, typename Preconditioner, typename VectorType>
+class SolverPipelinedCG : public SolverBase<VectorType>
+{
+public:
+  SolverPipelinedCG(Operator const &     underlying_operator_in,
+                    Preconditioner &     preconditioner_in,
+                    SolverDataCG const & solver_data_in)
+    : underlying_operator(underlying_operator_in),
+      preconditioner(preconditioner_in),
+      solver_data(solver_data_in)
+  {
+  }
+
+  void
+  update_preconditioner(bool const update_preconditioner) const override
+  {
+    if(solver_data.use_preconditioner and update_preconditioner)
+    {
+      preconditioner.update();
+    }
+  }
+
+  void
+  set_relative_tolerance(double const relative_tolerance) override
+  {
+    solver_data.solver_tolerance_rel = relative_tolerance;
+  }
+
+  unsigned int
+  solve(VectorType & dst, VectorType const & rhs) const override
+  {
+    dealii::Timer timer;
+
+    dealii::ReductionControl solver_control(solver_data.max_iter,
+                                            solver_data.solver_tolerance_abs,
+                                            solver_data.solver_tolerance_rel);
+
+    MPI_Comm const mpi_comm = rhs.get_mpi_communicator();
+
+    // z, q, s, and p enter the first iteration multiplied by beta = 0 and have to be
+    // zero-initialized, since 0 * NaN would result in NaN otherwise. The other vectors are
+    // overwritten before they are read.
+    VectorType r, u, w, m, n, p, s, q, z;
+    for(VectorType * vector : {&r, &u, &w, &m, &n})
+      vector->reinit(rhs, true);
+    for(VectorType * vector : {&p, &s, &q, &z})
+      vector->reinit(rhs);
+
+    // r = b - A x
+    underlying_operator.vmult(r, dst);
+    r.sadd(-1.0, 1.0, rhs);
+
+    // u = M^{-1} r, w = A u
+    apply_preconditioner(u, r);
+    underlying_operator.vmult(w, u);
+
+    double gamma_old = 1.0, alpha = 1.0;
+
+    dealii::SolverControl::State state = dealii::SolverControl::iterate;
+    for(unsigned int k = 0; state == dealii::SolverControl::iterate; ++k)
+    {
+      // local contributions to gamma = (r,u), delta = (w,u), and (r,r)
+      std::array<double, 3> sums = {{0.0, 0.0, 0.0}};
+      for(unsigned int i = 0; i < r.locally_owned_size(); ++i)
+      {
+        sums[0] += r.local_element(i) * u.local_element(i);
+        sums[1] += w.local_element(i) * u.local_element(i);
+        sums[2] += r.local_element(i) * r.local_element(i);
+      }
+
+      MPI_Request request;
+      int const   ierr =
+        MPI_Iallreduce(MPI_IN_PLACE, sums.data(), 3, MPI_DOUBLE, MPI_SUM, mpi_comm, &request);
+      AssertThrowMPI(ierr);
+
+      // hide the latency of the global reduction behind m = M^{-1} w, n = A m
+      apply_preconditioner(m, w);
+      underlying_operator.vmult(n, m);
+
+      MPI_Wait(&request, MPI_STATUS_IGNORE);
+
+      double const gamma = sums[0];
+      double const delta = sums[1];
+
+      state = solver_control.check(k, std::sqrt(sums[2]));
+      if(state != dealii::SolverControl::iterate)
+        break;
+
+      double beta = 0.0;
+      if(k > 0)
+      {
+        beta  = gamma / gamma_old;
+        alpha = gamma / (delta - beta * gamma / alpha);
+      }
+      else
+      {
+        alpha = gamma / delta;
+      }
+      gamma_old = gamma;
+
+      z.sadd(beta, 1.0, n);
+      q.sadd(beta, 1.0, m);
+      s.sadd(beta, 1.0, w);
+      p.sadd(beta, 1.0, u);
+
+      dst.add(alpha, p);
+
+      if((k + 1) % residual_replacement_interval == 0)
+      {
+        // residual replacement: recompute the vectors from their definitions
+        underlying_operator.vmult(r, dst);
+        r.sadd(-1.0, 1.0, rhs);
+        apply_preconditioner(u, r);
+        underlying_operator.vmult(w, u);
+        underlying_operator.vmult(s, p);
+        apply_preconditioner(q, s);
+        underlying_operator.vmult(z, q);
+      }
+      else
+      {
+        r.add(-alpha, s);
+        u.add(-alpha, q);
+        w.add(-alpha, z);
+      }
+    }
+
+    AssertThrow(state == dealii::SolverControl::success,
+                dealii::SolverControl::NoConvergence(solver_control.last_step(),
+                                                     solver_control.last_value()));
+
+    if(solver_data.compute_performance_metrics)
+      this->compute_performance_metrics(solver_control);
+
+    this->timer_tree->insert({"SolverPipelinedCG"}, timer.wall_time());
+
+    return solver_control.last_step();
+  }
+
+  std::shared_ptr<TimerTree>
+  get_timings() const override
+  {
+    if(solver_data.use_preconditioner)
+      this->timer_tree->insert({"SolverPipelinedCG"}, preconditioner.get_timings());
+
+    return this->timer_tree;
+  }
+
+private:
+  void
+  apply_preconditioner(VectorType & dst, VectorType const & src) const
+  {
+    if(solver_data.use_preconditioner)
+      preconditioner.vmult(dst, src);
+    else
+      dst = src;
+  }
+
+  static unsigned int const residual_replacement_interval = 50;
+
+  Operator const & underlying_operator;
+  Preconditioner & preconditioner;
+  SolverDataCG     solver_data;
 };
 
 template<class Number>
@@ -241,6 +627,12 @@ public:
     }
   }
 
+  void
+  set_relative_tolerance(double const relative_tolerance) override
+  {
+    solver_data.solver_tolerance_rel = relative_tolerance;
+  }
+
   unsigned int
   solve(VectorType & dst, VectorType const & rhs) const override
   {
@@ -293,9 +685,9 @@ public:
   }
 
 private:
-  Operator const &      underlying_operator;
-  Preconditioner &      preconditioner;
-  SolverDataGMRES const solver_data;
+  Operator const & underlying_operator;
+  Preconditioner & preconditioner;
+  SolverDataGMRES  solver_data;
 
   MPI_Comm const mpi_comm;
 };
@@ -346,6 +738,12 @@ public:
     }
   }
 
+  void
+  set_relative_tolerance(double const relative_tolerance) override
+  {
+    solver_data.solver_tolerance_rel = relative_tolerance;
+  }
+
   unsigned int
   solve(VectorType & dst, VectorType const & rhs) const override
   {
@@ -390,9 +788,9 @@ public:
   }
 
 private:
-  Operator const &       underlying_operator;
-  Preconditioner &       preconditioner;
-  SolverDataFGMRES const solver_data;
+  Operator const & underlying_operator;
+  Preconditioner & preconditioner;
+  SolverDataFGMRES solver_data;
 };
 } // namespace Krylov
 
@@ -77,6 +77,47 @@ compute_eigenvalues(Operator const &   op,
   return eigenvalues;
 }
 
+/*
+ * Estimates the maximum eigenvalue of the preconditioned operator P^{-1} A by power iterations,
+ * where A and P are symmetric positive (semi-)definite. The estimate is the Rayleigh quotient
+ * with respect to the A-inner product,
+ *
+ *   lambda = (P^{-1} A v, v)_A / (v, v)_A = (A v, P^{-1} A v) / (v, A v),
+ *
+ * which is a lower bound of the maximum eigenvalue and requires one application of A and of the
+ * preconditioner per iteration. The vector v is used as initial guess and contains the last
+ * iterate on exit, so that it can be used to warm-start subsequent estimates, e.g., after the
+ * operator has changed slightly.
+ */
+template<typename Operator, typename Preconditioner, typename VectorType>
+double
+estimate_max_eigenvalue_power_iteration(Operator const &       op,
+                                        Preconditioner const & preconditioner,
+                                        VectorType &           v,
+                                        unsigned int const     n_iterations)
+{
+  VectorType A_v, w;
+  A_v.reinit(v, true);
+  w.reinit(v, true);
+
+  double lambda = 0.0;
+  for(unsigned int i = 0; i < n_iterations; ++i)
+  {
+    v /= v.l2_norm();
+
+    op.vmult(A_v, v);
+    preconditioner.vmult(w, A_v);
+
+    double const v_times_A_v = v * A_v;
+    if(v_times_A_v > 0.0)
+      lambda = (A_v * w) / v_times_A_v;
+
+    v = w;
+  }
+
+  return lambda;
+}
+
 template<typename Number>
 struct EigenvalueTracker
 {
@@ -169,6 +169,27 @@ print_solver_info_nonlinear(dealii::ConditionalOStream const & pcout,
   // clang-format on
 }
 
+inline void
+print_solver_info_pseudo_transient(dealii::ConditionalOStream const & pcout,
+                                   unsigned int const                 N_pseudo_time_steps,
+                                   unsigned int const                 N_iter_linear,
+                                   double const                       wall_time)
+
+{
+  double const N_iter_linear_avg = (N_pseudo_time_steps > 0) ?
+                                     double(N_iter_linear) / double(N_pseudo_time_steps) :
+                                     N_iter_linear;
+
+  // clang-format off
+  pcout << std::endl
+        << "  Pseudo time steps:      " << std::setw(12) << std::right << N_pseudo_time_steps << std::endl
+        << "  Linear iterations (avg):" << std::setw(12) << std::fixed << std::setprecision(1) << std::right << N_iter_linear_avg << std::endl
+        << "  Linear iterations (tot):" << std::setw(12) << std::right << N_iter_linear << std::endl
+        << "  Wall time [s]:          " << std::setw(12) << std::scientific << std::setprecision(2) << std::right << wall_time << std::endl
+        << std::flush;
+  // clang-format on
+}
+
 inline void
 print_solver_info_linear(dealii::ConditionalOStream const & pcout,
                          unsigned int const                 N_iter_linear,
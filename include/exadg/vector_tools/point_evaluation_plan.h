@@ -0,0 +1,306 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+#ifndef INCLUDE_VECTOR_TOOLS_POINT_EVALUATION_PLAN_H_
+#define INCLUDE_VECTOR_TOOLS_POINT_EVALUATION_PLAN_H_
+
+// C/C++
+#include <algorithm>
+#include <map>
+
+// deal.II
+#include <deal.II/base/aligned_vector.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/point.h>
+#include <deal.II/base/polynomial.h>
+#include <deal.II/base/tensor.h>
+#include <deal.II/base/tensor_product_polynomials.h>
+#include <deal.II/base/vectorization.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_poly.h>
+#include <deal.II/fe/mapping.h>
+#include <deal.II/grid/grid_tools.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+namespace ExaDG
+{
+/*
+ * Evaluation of a finite element solution in a fixed set of points that is evaluated repeatedly,
+ * e.g. in every time step. The expensive part, i.e. the search of the cells around the points and
+ * the evaluation of the shape functions, is done once in reinit(). The points located in a cell
+ * are grouped into batches of the SIMD width, and the 1D shape values of the tensor-product
+ * element are stored per batch. evaluate() then only gathers the dof values of each cell and
+ * interpolates them to all points of a batch at once by a sequence of 1D contractions.
+ *
+ * As in evaluate_scalar_quantity_in_point(), the result in a point located on a face, edge, or
+ * vertex is the mean value over all adjacent cells on all processors. The values of points that
+ * are not found are set to zero.
+ *
+ * The cells and reference coordinates depend on the mapping. In case of a moving mesh, reinit()
+ * has to be called again after each mesh update.
+ *
+ * Only implemented for elements whose base element is a tensor-product polynomial space with
+ * the same degree in all directions, i.e. FE_DGQ, FE_Q, and their variants, as well as FESystem
+ * of one such base element.
+ */
+template<int dim, int n_components, typename Number>
+class PointEvaluationPlan
+{
+public:
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+  typedef dealii::VectorizedArray<Number>                    VectorizedArrayType;
+  typedef dealii::Tensor<1, n_components, Number>            value_type;
+
+  static unsigned int const n_lanes = VectorizedArrayType::size();
+
+  PointEvaluationPlan() : n_dofs_1d(0)
+  {
+  }
+
+  void
+  reinit(dealii::DoFHandler<dim> const &         dof_handler,
+         dealii::Mapping<dim> const &            mapping,
+         std::vector<dealii::Point<dim>> const & points,
+         MPI_Comm const &                        mpi_comm,
+         double const                            tolerance = 1.e-10)
+  {
+    dealii::FiniteElement<dim> const & fe = dof_handler.get_fe();
+
+    AssertThrow(fe.n_components() == n_components,
+                dealii::ExcMessage("Number of components of finite element does not match."));
+    AssertThrow(fe.n_base_elements() == 1,
+                dealii::ExcMessage("Only implemented for a single base element."));
+
+    // 1D polynomials and lexicographic numbering of the scalar base element
+    auto const fe_poly = dynamic_cast<dealii::FE_Poly<dim> const *>(&fe.base_element(0));
+    AssertThrow(fe_poly != nullptr,
+                dealii::ExcMessage("Only implemented for elements of type FE_Poly."));
+
+    auto const tensor_poly = dynamic_cast<dealii::TensorProductPolynomials<dim> const *>(
+      &fe_poly->get_poly_space());
+    AssertThrow(tensor_poly != nullptr,
+                dealii::ExcMessage("Only implemented for tensor-product polynomial spaces."));
+
+    polynomials_1d = tensor_poly->get_underlying_polynomials();
+    n_dofs_1d      = polynomials_1d.size();
+
+    std::vector<unsigned int> const lexicographic = fe_poly->get_poly_space_numbering_inverse();
+
+    unsigned int const n_dofs_per_component = dealii::Utilities::pow(n_dofs_1d, dim);
+    AssertThrow(lexicographic.size() == n_dofs_per_component,
+                dealii::ExcMessage("Only implemented for isotropic polynomial spaces."));
+
+    // find locally owned cells around points and group the points cell by cell
+    typedef typename dealii::DoFHandler<dim>::active_cell_iterator CellIterator;
+
+    std::map<CellIterator, std::vector<std::pair<unsigned int, dealii::Point<dim>>>> cell_to_points;
+
+    n_adjacent_cells.clear();
+    n_adjacent_cells.resize(points.size(), 0);
+
+    for(unsigned int p = 0; p < points.size(); ++p)
+    {
+      auto const adjacent_cells = dealii::GridTools::find_all_active_cells_around_point(
+        mapping, dof_handler, points[p], tolerance);
+
+      for(auto const & cell : adjacent_cells)
+      {
+        if(cell.first->is_locally_owned())
+        {
+          cell_to_points[cell.first].emplace_back(
+            p, dealii::GeometryInfo<dim>::project_to_unit_cell(cell.second));
+          ++n_adjacent_cells[p];
+        }
+      }
+    }
+
+    dealii::Utilities::MPI::sum(n_adjacent_cells, mpi_comm, n_adjacent_cells);
+
+    // fill cell data: dof indices in lexicographic order and 1D shape values of point batches
+    cell_data.clear();
+    cell_data.reserve(cell_to_points.size());
+
+    std::vector<dealii::types::global_dof_index> dof_indices(fe.dofs_per_cell);
+
+    for(auto const & cell_and_points : cell_to_points)
+    {
+      CellData data;
+
+      cell_and_points.first->get_dof_indices(dof_indices);
+      data.dof_indices.resize(n_components * n_dofs_per_component);
+      for(unsigned int c = 0; c < n_components; ++c)
+        for(unsigned int i = 0; i < n_dofs_per_component; ++i)
+          data.dof_indices[c * n_dofs_per_component + i] =
+            dof_indices[fe.component_to_system_index(c, lexicographic[i])];
+
+      auto const &       points_in_cell = cell_and_points.second;
+      unsigned int const n_batches      = (points_in_cell.size() + n_lanes - 1) / n_lanes;
+
+      data.point_indices.resize(n_batches * n_lanes, dealii::numbers::invalid_unsigned_int);
+      data.shape_values.resize_fast(n_batches * dim * n_dofs_1d);
+
+      for(unsigned int batch = 0; batch < n_batches; ++batch)
+      {
+        VectorizedArrayType * shape = &data.shape_values[batch * dim * n_dofs_1d];
+        for(unsigned int i = 0; i < dim * n_dofs_1d; ++i)
+          shape[i] = Number(0.0);
+
+        for(unsigned int v = 0; v < n_lanes && batch * n_lanes + v < points_in_cell.size(); ++v)
+        {
+          auto const & point = points_in_cell[batch * n_lanes + v];
+
+          data.point_indices[batch * n_lanes + v] = point.first;
+          for(unsigned int d = 0; d < dim; ++d)
+            for(unsigned int i = 0; i < n_dofs_1d; ++i)
+              shape[d * n_dofs_1d + i][v] = polynomials_1d[i].value(point.second[d]);
+        }
+      }
+
+      cell_data.push_back(std::move(data));
+    }
+  }
+
+  /*
+   * Returns true if every point has been found in at least one cell on one of the processors.
+   */
+  bool
+  all_points_found() const
+  {
+    for(auto const n : n_adjacent_cells)
+      if(n == 0)
+        return false;
+
+    return true;
+  }
+
+  /*
+   * Evaluates the solution in all points. The ghost values of the vector have to be up to date
+   * if the finite element is continuous. This function has to be called by all processors.
+   */
+  void
+  evaluate(std::vector<value_type> & values,
+           VectorType const &        solution,
+           MPI_Comm const &          mpi_comm) const
+  {
+    values.resize(n_adjacent_cells.size());
+    std::fill(values.begin(), values.end(), value_type());
+
+    unsigned int const n_dofs_per_component = dealii::Utilities::pow(n_dofs_1d, dim);
+
+    std::vector<Number>                        dof_values(n_dofs_per_component);
+    dealii::AlignedVector<VectorizedArrayType> tmp(n_dofs_per_component / n_dofs_1d);
+
+    for(auto const & data : cell_data)
+    {
+      unsigned int const n_batches = data.point_indices.size() / n_lanes;
+
+      for(unsigned int c = 0; c < n_components; ++c)
+      {
+        for(unsigned int i = 0; i < n_dofs_per_component; ++i)
+          dof_values[i] = solution(data.dof_indices[c * n_dofs_per_component + i]);
+
+        for(unsigned int batch = 0; batch < n_batches; ++batch)
+        {
+          VectorizedArrayType const result =
+            interpolate(dof_values, &data.shape_values[batch * dim * n_dofs_1d], tmp);
+
+          for(unsigned int v = 0; v < n_lanes; ++v)
+          {
+            unsigned int const p = data.point_indices[batch * n_lanes + v];
+            if(p != dealii::numbers::invalid_unsigned_int)
+              values[p][c] += result[v];
+          }
+        }
+      }
+    }
+
+    // sum over all processors and calculate mean value over adjacent cells
+    if(values.size() > 0)
+    {
+      dealii::ArrayView<Number> view(&values[0][0], n_components * values.size());
+      dealii::Utilities::MPI::sum(dealii::ArrayView<Number const>(view), mpi_comm, view);
+    }
+
+    for(unsigned int p = 0; p < values.size(); ++p)
+      if(n_adjacent_cells[p] > 0)
+        values[p] /= Number(n_adjacent_cells[p]);
+  }
+
+private:
+  /*
+   * Sum-factorized interpolation of the lexicographic dof values of one component to the
+   * n_lanes points of a batch, contracting one direction after the other.
+   */
+  VectorizedArrayType
+  interpolate(std::vector<Number> const &                  dof_values,
+              VectorizedArrayType const *                  shape,
+              dealii::AlignedVector<VectorizedArrayType> & tmp) const
+  {
+    unsigned int size = dof_values.size() / n_dofs_1d;
+
+    for(unsigned int i = 0; i < size; ++i)
+    {
+      VectorizedArrayType sum = shape[0] * dof_values[i * n_dofs_1d];
+      for(unsigned int j = 1; j < n_dofs_1d; ++j)
+        sum += shape[j] * dof_values[i * n_dofs_1d + j];
+      tmp[i] = sum;
+    }
+
+    for(unsigned int d = 1; d < dim; ++d)
+    {
+      size /= n_dofs_1d;
+      for(unsigned int i = 0; i < size; ++i)
+      {
+        VectorizedArrayType sum = shape[d * n_dofs_1d] * tmp[i * n_dofs_1d];
+        for(unsigned int j = 1; j < n_dofs_1d; ++j)
+          sum += shape[d * n_dofs_1d + j] * tmp[i * n_dofs_1d + j];
+        tmp[i] = sum;
+      }
+    }
+
+    return tmp[0];
+  }
+
+  struct CellData
+  {
+    // global dof indices in lexicographic order, component by component
+    std::vector<dealii::types::global_dof_index> dof_indices;
+
+    // indices of the points in the batches of this cell, invalid_unsigned_int for empty lanes
+    std::vector<unsigned int> point_indices;
+
+    // 1D shape values of the point batches, stored as [batch][direction][dof]
+    dealii::AlignedVector<VectorizedArrayType> shape_values;
+  };
+
+  std::vector<dealii::Polynomials::Polynomial<double>> polynomials_1d;
+
+  unsigned int n_dofs_1d;
+
+  std::vector<CellData> cell_data;
+
+  // number of adjacent cells of each point summed over all processors
+  std::vector<unsigned int> n_adjacent_cells;
+};
+
+} // namespace ExaDG
+
+#endif /* INCLUDE_VECTOR_TOOLS_POINT_EVALUATION_PLAN_H_ */
@@ -0,0 +1,165 @@
+// C/C++
+#include <algorithm>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/matrix_free/dof_renumbering.h>
+
+/*
+ * Benchmark of the throughput of a matrix-free DG operator with cell and face integrals (Laplace
+ * operator with interior penalty fluxes) with the default DoF numbering and with the DoFs
+ * renumbered for data locality, see ExaDG::renumber_dofs_for_data_locality(). Reports the number
+ * of DoFs processed per second.
+ */
+template<int dim>
+double
+do_benchmark_operator(unsigned int const n_subdivisions,
+                      unsigned int const degree,
+                      bool const         renumber_dofs,
+                      unsigned int const n_repetitions)
+{
+  typedef double                                             Number;
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  dealii::parallel::distributed::Triangulation<dim> tria(MPI_COMM_WORLD);
+  dealii::GridGenerator::subdivided_hyper_cube(tria, n_subdivisions);
+
+  dealii::MappingQ<dim>             mapping(1);
+  dealii::AffineConstraints<Number> constraints;
+  constraints.close();
+
+  dealii::FE_DGQ<dim>     fe(degree);
+  dealii::DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  if(renumber_dofs)
+    ExaDG::renumber_dofs_for_data_locality(dof_handler);
+
+  typename dealii::MatrixFree<dim, Number>::AdditionalData additional_data;
+  additional_data.tasks_parallel_scheme = dealii::MatrixFree<dim, Number>::AdditionalData::none;
+  additional_data.mapping_update_flags = dealii::update_gradients | dealii::update_JxW_values;
+  additional_data.mapping_update_flags_inner_faces =
+    dealii::update_gradients | dealii::update_JxW_values | dealii::update_normal_vectors;
+
+  dealii::MatrixFree<dim, Number> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, dealii::QGauss<1>(degree + 1), additional_data);
+
+  VectorType src, dst;
+  matrix_free.initialize_dof_vector(src);
+  matrix_free.initialize_dof_vector(dst);
+  src = 1.0;
+
+  Number const tau = (degree + 1) * (degree + 1) * n_subdivisions;
+
+  auto const cell_operation = [](dealii::MatrixFree<dim, Number> const &       data,
+                                 VectorType &                                  dst,
+                                 VectorType const &                            src,
+                                 std::pair<unsigned int, unsigned int> const & cell_range) {
+    dealii::FEEvaluation<dim, -1, 0, 1, Number> integrator(data);
+    for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.gather_evaluate(src, dealii::EvaluationFlags::gradients);
+      for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+        integrator.submit_gradient(integrator.get_gradient(q), q);
+      integrator.integrate_scatter(dealii::EvaluationFlags::gradients, dst);
+    }
+  };
+
+  auto const face_operation = [&](dealii::MatrixFree<dim, Number> const &       data,
+                                  VectorType &                                  dst,
+                                  VectorType const &                            src,
+                                  std::pair<unsigned int, unsigned int> const & face_range) {
+    dealii::FEFaceEvaluation<dim, -1, 0, 1, Number> integrator_m(data, true);
+    dealii::FEFaceEvaluation<dim, -1, 0, 1, Number> integrator_p(data, false);
+    for(unsigned int face = face_range.first; face < face_range.second; ++face)
+    {
+      integrator_m.reinit(face);
+      integrator_p.reinit(face);
+      integrator_m.gather_evaluate(src,
+                                   dealii::EvaluationFlags::values |
+                                     dealii::EvaluationFlags::gradients);
+      integrator_p.gather_evaluate(src,
+                                   dealii::EvaluationFlags::values |
+                                     dealii::EvaluationFlags::gradients);
+      for(unsigned int q = 0; q < integrator_m.n_q_points; ++q)
+      {
+        auto const jump = integrator_m.get_value(q) - integrator_p.get_value(q);
+        auto const average_gradient =
+          0.5 * (integrator_m.get_normal_derivative(q) + integrator_p.get_normal_derivative(q));
+        auto const flux = tau * jump - average_gradient;
+
+        integrator_m.submit_value(flux, q);
+        integrator_p.submit_value(-flux, q);
+        integrator_m.submit_normal_derivative(-0.5 * jump, q);
+        integrator_p.submit_normal_derivative(-0.5 * jump, q);
+      }
+      integrator_m.integrate_scatter(dealii::EvaluationFlags::values |
+                                       dealii::EvaluationFlags::gradients,
+                                     dst);
+      integrator_p.integrate_scatter(dealii::EvaluationFlags::values |
+                                       dealii::EvaluationFlags::gradients,
+                                     dst);
+    }
+  };
+
+  auto const boundary_operation = [](dealii::MatrixFree<dim, Number> const &,
+                                     VectorType &,
+                                     VectorType const &,
+                                     std::pair<unsigned int, unsigned int> const &) {};
+
+  // warm up
+  matrix_free.loop(cell_operation, face_operation, boundary_operation, dst, src, true);
+
+  dealii::Timer timer;
+  for(unsigned int i = 0; i < n_repetitions; ++i)
+    matrix_free.loop(cell_operation, face_operation, boundary_operation, dst, src, true);
+  double const time = dealii::Utilities::MPI::max(timer.wall_time(), MPI_COMM_WORLD);
+
+  return dof_handler.n_dofs() * n_repetitions / time;
+}
+
+int
+main(int argc, char ** argv)
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  bool const print = dealii::Utilities::MPI::this_mpi_process(MPI_COMM_WORLD) == 0;
+
+  for(unsigned int degree = 1; degree <= 6; ++degree)
+  {
+    // about 1e7 DoFs to exceed the cache sizes
+    unsigned int const n_subdivisions =
+      std::max(2, (int)std::round(std::cbrt(1.0e7) / (degree + 1)));
+
+    double const throughput_default = do_benchmark_operator<3>(n_subdivisions, degree, false, 20);
+    double const throughput_renumbered = do_benchmark_operator<3>(n_subdivisions, degree, true, 20);
+
+    if(print)
+      std::cout << "DG Laplace operator (dim = 3, degree = " << degree
+                << ", cells = " << dealii::Utilities::pow(n_subdivisions, 3)
+                << "):" << std::endl
+                << "  default DoF numbering:    " << std::setw(10) << throughput_default
+                << " DoFs/s" << std::endl
+                << "  locality DoF numbering:   " << std::setw(10) << throughput_renumbered
+                << " DoFs/s (speedup " << throughput_renumbered / throughput_default << ")"
+                << std::endl;
+  }
+}
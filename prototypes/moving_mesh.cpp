@@ -1,19 +1,26 @@
 
 // C/C++
 #include <fstream>
+#include <iostream>
 
 // deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/timer.h>
 #include <deal.II/dofs/dof_tools.h>
 #include <deal.II/fe/fe_q.h>
 #include <deal.II/fe/fe_system.h>
 #include <deal.II/fe/fe_values.h>
 #include <deal.II/fe/mapping_fe_field.h>
 #include <deal.II/fe/mapping_q.h>
+#include <deal.II/fe/mapping_q_cache.h>
 #include <deal.II/grid/grid_generator.h>
 #include <deal.II/grid/tria.h>
 #include <deal.II/lac/la_parallel_vector.h>
 #include <deal.II/numerics/data_out.h>
 
+// ExaDG
+#include <exadg/grid/mapping_dof_vector.h>
+
 
 
 void
@@ -125,8 +132,60 @@ do_test()
 }
 
 
+/*
+ * Compares the setup of the multigrid mappings (local smoothing) from scratch to the update of the
+ * grid coordinates only, where the topology-dependent data structures are reused as done for
+ * moving meshes in MultigridPreconditionerBase.
+ */
+template<int dim>
+void
+do_benchmark_multigrid_mapping(unsigned int const n_refinements,
+                               unsigned int const mapping_degree,
+                               unsigned int const n_repetitions)
+{
+  typedef float Number;
+
+  dealii::Triangulation<dim> tria(dealii::Triangulation<dim>::limit_level_difference_at_vertices);
+  dealii::GridGenerator::hyper_ball(tria);
+  tria.refine_global(n_refinements);
+
+  std::shared_ptr<dealii::MappingQCache<dim>> mapping =
+    std::make_shared<dealii::MappingQCache<dim>>(mapping_degree);
+  mapping->initialize(dealii::MappingQ<dim>(mapping_degree), tria);
+  std::shared_ptr<dealii::MappingQCache<dim> const> mapping_q_cache = mapping;
+
+  std::shared_ptr<ExaDG::MappingDoFVector<dim, Number>> mapping_multigrid =
+    std::make_shared<ExaDG::MappingDoFVector<dim, Number>>(mapping_degree);
+
+  dealii::Timer timer;
+  for(unsigned int i = 0; i < n_repetitions; ++i)
+    ExaDG::MappingTools::initialize_multigrid(mapping_multigrid, mapping_q_cache, tria);
+  double const time_setup = timer.wall_time() / n_repetitions;
+
+  timer.restart();
+  ExaDG::MappingTools::MultigridMappingLocalSmoothing<dim, Number> multigrid_mapping(
+    tria, mapping_degree);
+  double const time_initialization = timer.wall_time();
+
+  timer.restart();
+  for(unsigned int i = 0; i < n_repetitions; ++i)
+    multigrid_mapping.update(*mapping_multigrid, *mapping_q_cache);
+  double const time_update = timer.wall_time() / n_repetitions;
+
+  std::cout << "Multigrid mapping (dim = " << dim << ", cells = " << tria.n_active_cells()
+            << ", mapping degree = " << mapping_degree << "):" << std::endl
+            << "  setup from scratch:     " << time_setup << " s" << std::endl
+            << "  setup reusable data:    " << time_initialization << " s" << std::endl
+            << "  geometry update only:   " << time_update << " s" << std::endl;
+}
+
 int
-main()
+main(int argc, char ** argv)
 {
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
   do_test();
+
+  do_benchmark_multigrid_mapping<2>(5, 3, 10);
+  do_benchmark_multigrid_mapping<3>(3, 3, 10);
 }
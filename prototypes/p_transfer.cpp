@@ -0,0 +1,128 @@
+// C/C++
+#include <iomanip>
+#include <iostream>
+
+// deal.II
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/quadrature_lib.h>
+#include <deal.II/base/timer.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/matrix_free/fe_evaluation.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/multigrid/transfers/mg_transfer_p.h>
+
+/*
+ * Micro-benchmark of the polynomial transfer operators of the hp-multigrid method: measures the
+ * cost of prolongation and restriction between the degrees fe_degree_1 (fine) and fe_degree_2
+ * (coarse) relative to a cell-local Laplace operator on the fine level, which is a lower bound for
+ * the cost of one smoother sweep.
+ */
+template<int dim>
+void
+do_benchmark_p_transfer(unsigned int const n_refinements,
+                        unsigned int const fe_degree_1,
+                        unsigned int const fe_degree_2,
+                        unsigned int const n_repetitions)
+{
+  typedef double                                             Number;
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  dealii::Triangulation<dim> tria;
+  dealii::GridGenerator::hyper_cube(tria);
+  tria.refine_global(n_refinements);
+
+  dealii::MappingQ<dim>             mapping(1);
+  dealii::AffineConstraints<Number> constraints;
+  constraints.close();
+
+  dealii::FE_DGQ<dim>     fe_1(fe_degree_1), fe_2(fe_degree_2);
+  dealii::DoFHandler<dim> dof_handler_1(tria), dof_handler_2(tria);
+  dof_handler_1.distribute_dofs(fe_1);
+  dof_handler_2.distribute_dofs(fe_2);
+
+  typename dealii::MatrixFree<dim, Number>::AdditionalData additional_data;
+  additional_data.mapping_update_flags = dealii::update_gradients | dealii::update_JxW_values;
+
+  dealii::MatrixFree<dim, Number> matrix_free_1, matrix_free_2;
+  matrix_free_1.reinit(
+    mapping, dof_handler_1, constraints, dealii::QGauss<1>(fe_degree_1 + 1), additional_data);
+  matrix_free_2.reinit(
+    mapping, dof_handler_2, constraints, dealii::QGauss<1>(fe_degree_2 + 1), additional_data);
+
+  ExaDG::MGTransferP<dim, Number, VectorType, 1> transfer(&matrix_free_1,
+                                                          &matrix_free_2,
+                                                          fe_degree_1,
+                                                          fe_degree_2);
+
+  VectorType vector_1, vector_2;
+  matrix_free_1.initialize_dof_vector(vector_1);
+  matrix_free_2.initialize_dof_vector(vector_2);
+  vector_1 = 1.0;
+  vector_2 = 1.0;
+
+  dealii::Timer timer;
+  for(unsigned int i = 0; i < n_repetitions; ++i)
+    transfer.prolongate_and_add(0, vector_1, vector_2);
+  double const time_prolongation = timer.wall_time() / n_repetitions;
+
+  timer.restart();
+  for(unsigned int i = 0; i < n_repetitions; ++i)
+    transfer.restrict_and_add(0, vector_2, vector_1);
+  double const time_restriction = timer.wall_time() / n_repetitions;
+
+  // cell-local Laplace operator on the fine level as reference
+  VectorType dst;
+  matrix_free_1.initialize_dof_vector(dst);
+
+  auto const cell_operation = [](dealii::MatrixFree<dim, Number> const &       data,
+                                 VectorType &                                  dst,
+                                 VectorType const &                            src,
+                                 std::pair<unsigned int, unsigned int> const & cell_range) {
+    dealii::FEEvaluation<dim, -1, 0, 1, Number> integrator(data);
+    for(unsigned int cell = cell_range.first; cell < cell_range.second; ++cell)
+    {
+      integrator.reinit(cell);
+      integrator.gather_evaluate(src, dealii::EvaluationFlags::gradients);
+      for(unsigned int q = 0; q < integrator.n_q_points; ++q)
+        integrator.submit_gradient(integrator.get_gradient(q), q);
+      integrator.integrate_scatter(dealii::EvaluationFlags::gradients, dst);
+    }
+  };
+
+  timer.restart();
+  for(unsigned int i = 0; i < n_repetitions; ++i)
+    matrix_free_1.cell_loop(cell_operation, dst, vector_1, true);
+  double const time_operator = timer.wall_time() / n_repetitions;
+
+  std::cout << "p-transfer (dim = " << dim << ", degrees = " << std::setw(2) << fe_degree_1
+            << " -> " << std::setw(2) << fe_degree_2 << ", cells = " << tria.n_active_cells()
+            << "):" << std::endl
+            << "  prolongation:           " << time_prolongation << " s ("
+            << time_prolongation / time_operator << " x cell operator)" << std::endl
+            << "  restriction:            " << time_restriction << " s ("
+            << time_restriction / time_operator << " x cell operator)" << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  // degree pairs of the p-sequences DecreaseByOne, Bisect, and GoToOne
+  for(unsigned int degree = 2; degree <= 15; ++degree)
+  {
+    do_benchmark_p_transfer<3>(2, degree, degree - 1, 20);
+    if(degree / 2 > 1 && degree / 2 < degree - 1)
+      do_benchmark_p_transfer<3>(2, degree, degree / 2, 20);
+    if(degree > 2)
+      do_benchmark_p_transfer<3>(2, degree, 1, 20);
+  }
+}
@@ -0,0 +1,104 @@
+// C/C++
+#include <algorithm>
+#include <iostream>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/mpi.h>
+#include <deal.II/base/timer.h>
+#include <deal.II/distributed/tria.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_dgq.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/vector_tools/point_evaluation_plan.h>
+#include <exadg/vector_tools/point_value.h>
+
+/*
+ * Micro-benchmark of the repeated evaluation of a vector-valued DG solution in a fixed set of
+ * points: compares the search of the points and the evaluation with FEValues in every call
+ * (evaluate_vectorial_quantity_in_point) to the evaluation with a PointEvaluationPlan set up once.
+ */
+template<int dim>
+void
+do_benchmark_point_evaluation(unsigned int const n_refinements,
+                              unsigned int const fe_degree,
+                              unsigned int const n_points_1d,
+                              unsigned int const n_repetitions)
+{
+  typedef double                                             Number;
+  typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+  MPI_Comm const comm = MPI_COMM_WORLD;
+
+  dealii::parallel::distributed::Triangulation<dim> tria(comm);
+  dealii::GridGenerator::hyper_cube(tria);
+  tria.refine_global(n_refinements);
+
+  dealii::MappingQ<dim>   mapping(1);
+  dealii::FESystem<dim>   fe(dealii::FE_DGQ<dim>(fe_degree), dim);
+  dealii::DoFHandler<dim> dof_handler(tria);
+  dof_handler.distribute_dofs(fe);
+
+  VectorType solution(dof_handler.locally_owned_dofs(), comm);
+  dealii::VectorTools::interpolate(mapping,
+                                   dof_handler,
+                                   dealii::Functions::CosineFunction<dim>(dim),
+                                   solution);
+
+  // points on a plane inside the domain, as for inflow data
+  std::vector<dealii::Point<dim>> points;
+  for(unsigned int i = 0; i < dealii::Utilities::pow(n_points_1d, dim - 1); ++i)
+  {
+    dealii::Point<dim> point;
+    point[0] = 0.5;
+    for(unsigned int d = 1, index = i; d < dim; ++d, index /= n_points_1d)
+      point[d] = (0.5 + index % n_points_1d) / n_points_1d;
+    points.push_back(point);
+  }
+
+  dealii::Timer timer;
+
+  std::vector<dealii::Tensor<1, dim, Number>> values_reference(points.size());
+  for(unsigned int p = 0; p < points.size(); ++p)
+    ExaDG::evaluate_vectorial_quantity_in_point(
+      values_reference[p], dof_handler, mapping, solution, points[p], comm);
+  double const time_reference = timer.wall_time();
+
+  timer.restart();
+  ExaDG::PointEvaluationPlan<dim, dim, Number> plan;
+  plan.reinit(dof_handler, mapping, points, comm);
+  double const time_setup = timer.wall_time();
+
+  std::vector<dealii::Tensor<1, dim, Number>> values;
+  timer.restart();
+  for(unsigned int i = 0; i < n_repetitions; ++i)
+    plan.evaluate(values, solution, comm);
+  double const time_plan = timer.wall_time() / n_repetitions;
+
+  double error = 0.0;
+  for(unsigned int p = 0; p < points.size(); ++p)
+    error = std::max(error, (values[p] - values_reference[p]).norm());
+
+  if(dealii::Utilities::MPI::this_mpi_process(comm) == 0)
+    std::cout << "point evaluation (dim = " << dim << ", degree = " << fe_degree
+              << ", points = " << points.size() << "):" << std::endl
+              << "  search and evaluate:    " << time_reference << " s" << std::endl
+              << "  plan setup:             " << time_setup << " s" << std::endl
+              << "  plan evaluate:          " << time_plan << " s (" << time_reference / time_plan
+              << " x faster), max error " << error << std::endl;
+}
+
+int
+main(int argc, char ** argv)
+{
+  dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+  for(unsigned int degree = 1; degree <= 8; ++degree)
+    do_benchmark_point_evaluation<3>(3, degree, 100, 20);
+}
@@ -0,0 +1,210 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <iostream>
+
+// deal.II
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/poisson/spatial_discretization/laplace_operator.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/jacobi_preconditioner.h>
+#include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
+
+/*
+ * Solves a scalar Poisson problem discretized with continuous Q2 elements on an adaptively refined
+ * grid with a Jacobi-preconditioned CG solver. The grid is then refined adaptively once more, the
+ * operator is re-initialized on the new grid, and the existing preconditioner is updated (instead
+ * of being recreated) before solving again, as done in the adaptive mesh refinement of the
+ * solvers, where multigrid preconditioners are not supported since the grid has hanging nodes.
+ */
+namespace ExaDG
+{
+unsigned int const dim    = 2;
+unsigned int const degree = 2;
+
+typedef double Number;
+
+typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+typedef Poisson::LaplaceOperator<dim, Number, 1> Operator;
+
+typedef Krylov::SolverCG<Operator, JacobiPreconditioner<Operator>, VectorType> Solver;
+
+void
+refine_lower_left_cells(dealii::Triangulation<dim> & triangulation)
+{
+  for(auto const & cell : triangulation.active_cell_iterators())
+    if(cell->center()[0] < 0.5 and cell->center()[1] < 0.5)
+      cell->set_refine_flag();
+
+  triangulation.execute_coarsening_and_refinement();
+}
+
+void
+setup(dealii::DoFHandler<dim> &           dof_handler,
+      dealii::AffineConstraints<Number> & constraints,
+      dealii::MatrixFree<dim, Number> &   matrix_free,
+      dealii::Mapping<dim> const &        mapping,
+      dealii::FE_Q<dim> const &           fe)
+{
+  dof_handler.distribute_dofs(fe);
+
+  constraints.clear();
+  dealii::DoFTools::make_hanging_node_constraints(dof_handler, constraints);
+  dealii::DoFTools::make_zero_boundary_constraints(dof_handler, 0, constraints);
+  constraints.close();
+
+  typename dealii::MatrixFree<dim, Number>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    dealii::update_gradients | dealii::update_JxW_values | dealii::update_quadrature_points;
+  additional_data.mapping_update_flags_boundary_faces =
+    dealii::update_gradients | dealii::update_JxW_values | dealii::update_quadrature_points;
+
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, dealii::QGauss<1>(degree + 1), additional_data);
+}
+
+bool
+solve(Operator const &                          laplace_operator,
+      Solver const &                            solver,
+      dealii::AffineConstraints<Number> const & constraints)
+{
+  VectorType rhs, solution, residual;
+  laplace_operator.initialize_dof_vector(rhs);
+  laplace_operator.initialize_dof_vector(solution);
+  laplace_operator.initialize_dof_vector(residual);
+
+  rhs = 1.0;
+  constraints.set_zero(rhs);
+
+  solver.solve(solution, rhs);
+
+  laplace_operator.vmult(residual, solution);
+  residual.sadd(-1.0, 1.0, rhs);
+
+  return residual.l2_norm() < 1.e-6 * rhs.l2_norm();
+}
+
+void
+test()
+{
+  dealii::Triangulation<dim> triangulation;
+  dealii::GridGenerator::hyper_cube(triangulation, 0.0, 1.0);
+  triangulation.refine_global(2);
+  refine_lower_left_cells(triangulation);
+
+  dealii::MappingQ<dim> mapping(1);
+
+  dealii::FE_Q<dim>                 fe(degree);
+  dealii::DoFHandler<dim>           dof_handler(triangulation);
+  dealii::AffineConstraints<Number> constraints;
+  dealii::MatrixFree<dim, Number>   matrix_free;
+
+  setup(dof_handler, constraints, matrix_free, mapping, fe);
+
+  std::shared_ptr<Poisson::BoundaryDescriptor<0, dim>> boundary_descriptor =
+    std::make_shared<Poisson::BoundaryDescriptor<0, dim>>();
+  boundary_descriptor->dirichlet_bc.insert(
+    std::make_pair(0, std::make_shared<dealii::Functions::ZeroFunction<dim>>(1)));
+
+  Poisson::LaplaceOperatorData<0, dim> operator_data;
+  operator_data.bc = boundary_descriptor;
+
+  Operator laplace_operator;
+  laplace_operator.initialize(matrix_free, constraints, operator_data);
+
+  JacobiPreconditioner<Operator> preconditioner(laplace_operator);
+
+  Krylov::SolverDataCG solver_data;
+  solver_data.max_iter             = 1000;
+  solver_data.solver_tolerance_abs = 1.e-14;
+  solver_data.solver_tolerance_rel = 1.e-8;
+  solver_data.use_preconditioner   = true;
+
+  Solver solver(laplace_operator, preconditioner, solver_data);
+
+  std::cout << "Grid has hanging nodes: " << (triangulation.has_hanging_nodes() ? "yes" : "no")
+            << std::endl;
+  std::cout << "Converged before adaptive refinement: "
+            << (solve(laplace_operator, solver, constraints) ? "yes" : "no") << std::endl;
+
+  dealii::types::global_dof_index const n_dofs_before = dof_handler.n_dofs();
+
+  refine_lower_left_cells(triangulation);
+  setup(dof_handler, constraints, matrix_free, mapping, fe);
+  laplace_operator.initialize(matrix_free, constraints, operator_data);
+  solver.update_preconditioner(true);
+
+  std::cout << "Number of unknowns increased: "
+            << (dof_handler.n_dofs() > n_dofs_before ? "yes" : "no") << std::endl;
+  std::cout << "Size of the updated preconditioner matches: "
+            << (preconditioner.get_size_of_diagonal() == dof_handler.n_dofs() ? "yes" : "no")
+            << std::endl;
+  std::cout << "Converged after adaptive refinement: "
+            << (solve(laplace_operator, solver, constraints) ? "yes" : "no") << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    ExaDG::test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
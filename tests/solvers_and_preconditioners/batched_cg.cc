@@ -0,0 +1,189 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+
+// deal.II
+#include <deal.II/lac/la_parallel_block_vector.h>
+#include <deal.II/lac/la_parallel_vector.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/solvers/batched_krylov_solvers.h>
+#include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
+
+/*
+ * Compares SolverCGBatched for several right-hand sides to separate solves with SolverCG
+ * (number of iterations and solutions) for a symmetric positive definite tridiagonal matrix, with
+ * and without (Jacobi) preconditioner. The right-hand sides are scaled differently so that the
+ * blocks converge after different numbers of iterations.
+ */
+namespace ExaDG
+{
+typedef dealii::LinearAlgebra::distributed::Vector<double>      VectorType;
+typedef dealii::LinearAlgebra::distributed::BlockVector<double> BlockVectorType;
+
+unsigned int const n        = 200;
+unsigned int const n_blocks = 3;
+
+double
+diagonal(unsigned int const i)
+{
+  return 2.0 + (i % 5);
+}
+
+class TridiagonalMatrix
+{
+public:
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    for(unsigned int i = 0; i < n; ++i)
+    {
+      dst.local_element(i) = diagonal(i) * src.local_element(i);
+      if(i > 0)
+        dst.local_element(i) -= src.local_element(i - 1);
+      if(i < n - 1)
+        dst.local_element(i) -= src.local_element(i + 1);
+    }
+  }
+
+  void
+  apply_batched(BlockVectorType & dst, BlockVectorType const & src) const
+  {
+    for(unsigned int b = 0; b < src.n_blocks(); ++b)
+      vmult(dst.block(b), src.block(b));
+  }
+};
+
+class PreconditionerJacobi
+{
+public:
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    for(unsigned int i = 0; i < n; ++i)
+      dst.local_element(i) = src.local_element(i) / diagonal(i);
+  }
+
+  void
+  update()
+  {
+  }
+
+  std::shared_ptr<TimerTree>
+  get_timings() const
+  {
+    return std::make_shared<TimerTree>();
+  }
+};
+
+void
+test(bool const use_preconditioner)
+{
+  std::cout << std::endl
+            << (use_preconditioner ? "With Jacobi preconditioner:" : "Without preconditioner:")
+            << std::endl;
+
+  TridiagonalMatrix    matrix;
+  PreconditionerJacobi preconditioner;
+
+  Krylov::SolverDataCG solver_data;
+  solver_data.max_iter             = 1000;
+  solver_data.solver_tolerance_abs = 1.e-8;
+  solver_data.solver_tolerance_rel = 1.e-10;
+  solver_data.use_preconditioner   = use_preconditioner;
+
+  // the absolute tolerance is reached earlier for the blocks with smaller right-hand sides
+  BlockVectorType rhs(n_blocks, n), solution(n_blocks, n);
+  for(unsigned int b = 0; b < n_blocks; ++b)
+    for(unsigned int i = 0; i < n; ++i)
+      rhs.block(b).local_element(i) = std::pow(1.e-2, b) * (1.0 + 0.01 * i * (b + 1));
+
+  // batched solve
+  typedef Krylov::SolverCGBatched<TridiagonalMatrix, PreconditionerJacobi, BlockVectorType>
+    SolverBatched;
+
+  SolverBatched      solver_batched(matrix, preconditioner, solver_data);
+  unsigned int const n_iterations_batched = solver_batched.solve(solution, rhs);
+
+  // separate solves
+  Krylov::SolverCG<TridiagonalMatrix, PreconditionerJacobi, VectorType> solver(matrix,
+                                                                               preconditioner,
+                                                                               solver_data);
+
+  unsigned int n_iterations_max = 0;
+  bool         same_solution    = true;
+  for(unsigned int b = 0; b < n_blocks; ++b)
+  {
+    VectorType solution_reference(n);
+    n_iterations_max = std::max(n_iterations_max, solver.solve(solution_reference, rhs.block(b)));
+
+    VectorType difference(solution.block(b));
+    difference -= solution_reference;
+    same_solution = same_solution and
+                    difference.linfty_norm() < 1.e-8 * solution_reference.linfty_norm();
+  }
+
+  std::cout << "  Same maximum number of iterations: "
+            << (n_iterations_batched == n_iterations_max ? "yes" : "no") << std::endl
+            << "  Same solutions: " << (same_solution ? "yes" : "no") << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    ExaDG::test(false);
+    ExaDG::test(true);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
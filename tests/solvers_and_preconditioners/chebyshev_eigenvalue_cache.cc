@@ -0,0 +1,192 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <iostream>
+#include <memory>
+
+// deal.II
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/lac/diagonal_matrix.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/poisson/spatial_discretization/laplace_operator.h>
+#include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
+#include <exadg/solvers_and_preconditioners/multigrid/smoothers/chebyshev_eigenvalue_cache.h>
+#include <exadg/solvers_and_preconditioners/multigrid/smoothers/chebyshev_smoother.h>
+
+/*
+ * Sets up a point-Jacobi Chebyshev smoother for a scalar Poisson problem discretized with
+ * continuous Q2 elements via ChebyshevEigenvalueCache, first with the CG-based eigenvalue
+ * estimation and then from the cache for the unchanged operator. The cache hit has to reproduce
+ * the eigenvalue bounds of the estimation, so that both smoothers give the same result.
+ */
+namespace ExaDG
+{
+unsigned int const dim    = 2;
+unsigned int const degree = 2;
+
+typedef double Number;
+
+typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+typedef Poisson::LaplaceOperator<dim, Number, 1> Operator;
+
+typedef ChebyshevSmoother<Operator, VectorType, dealii::DiagonalMatrix<VectorType>> Chebyshev;
+
+void
+test()
+{
+  dealii::Triangulation<dim> triangulation;
+  dealii::GridGenerator::hyper_cube(triangulation, 0.0, 1.0);
+  triangulation.refine_global(3);
+
+  dealii::MappingQ<dim> mapping(1);
+
+  dealii::FE_Q<dim>       fe(degree);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  dealii::AffineConstraints<Number> constraints;
+  dealii::DoFTools::make_zero_boundary_constraints(dof_handler, 0, constraints);
+  constraints.close();
+
+  typename dealii::MatrixFree<dim, Number>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    dealii::update_gradients | dealii::update_JxW_values | dealii::update_quadrature_points;
+  additional_data.mapping_update_flags_boundary_faces =
+    dealii::update_gradients | dealii::update_JxW_values | dealii::update_quadrature_points;
+
+  dealii::MatrixFree<dim, Number> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, dealii::QGauss<1>(degree + 1), additional_data);
+
+  std::shared_ptr<Poisson::BoundaryDescriptor<0, dim>> boundary_descriptor =
+    std::make_shared<Poisson::BoundaryDescriptor<0, dim>>();
+  boundary_descriptor->dirichlet_bc.insert(
+    std::make_pair(0, std::make_shared<dealii::Functions::ZeroFunction<dim>>(1)));
+
+  Poisson::LaplaceOperatorData<0, dim> operator_data;
+  operator_data.bc = boundary_descriptor;
+
+  Operator laplace_operator;
+  laplace_operator.initialize(matrix_free, constraints, operator_data);
+
+  std::shared_ptr<dealii::DiagonalMatrix<VectorType>> diagonal_matrix =
+    std::make_shared<dealii::DiagonalMatrix<VectorType>>();
+  VectorType & inverse_diagonal = diagonal_matrix->get_vector();
+  laplace_operator.initialize_dof_vector(inverse_diagonal);
+  laplace_operator.calculate_inverse_diagonal(inverse_diagonal);
+
+  SmootherData data;
+  data.smoother                   = MultigridSmoother::Chebyshev;
+  data.reuse_eigenvalue_estimates = true;
+
+  ChebyshevEigenvalueCache<VectorType> cache;
+
+  // first setup with CG-based eigenvalue estimation
+  Chebyshev::AdditionalData smoother_data_estimated;
+  smoother_data_estimated.preconditioner      = diagonal_matrix;
+  smoother_data_estimated.smoothing_range     = data.smoothing_range;
+  smoother_data_estimated.degree              = data.iterations;
+  smoother_data_estimated.eig_cg_n_iterations = data.iterations_eigenvalue_estimation;
+
+  Chebyshev smoother_estimated;
+  cache.initialize_smoother(
+    smoother_estimated, smoother_data_estimated, laplace_operator, inverse_diagonal, data);
+
+  double const max_eigenvalue_estimated = cache.get_max_eigenvalue();
+
+  // second setup for the same operator, which is a cache hit
+  Chebyshev::AdditionalData smoother_data_cached = smoother_data_estimated;
+
+  Chebyshev smoother_cached;
+  cache.initialize_smoother(
+    smoother_cached, smoother_data_cached, laplace_operator, inverse_diagonal, data);
+
+  std::cout << "Cache hit skips the eigenvalue estimation: "
+            << (smoother_data_cached.eig_cg_n_iterations == 0 ? "yes" : "no") << std::endl;
+  std::cout << "Cache hit reproduces the maximum eigenvalue: "
+            << (smoother_data_cached.max_eigenvalue == max_eigenvalue_estimated ? "yes" : "no")
+            << std::endl;
+
+  VectorType src, dst_estimated, dst_cached;
+  laplace_operator.initialize_dof_vector(src);
+  laplace_operator.initialize_dof_vector(dst_estimated);
+  laplace_operator.initialize_dof_vector(dst_cached);
+
+  src = 1.0;
+  constraints.set_zero(src);
+
+  smoother_estimated.vmult(dst_estimated, src);
+  smoother_cached.vmult(dst_cached, src);
+
+  dst_cached -= dst_estimated;
+
+  std::cout << "Cache hit reproduces the smoother: "
+            << (dst_cached.l2_norm() < 1.e-12 * dst_estimated.l2_norm() ? "yes" : "no")
+            << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    ExaDG::test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
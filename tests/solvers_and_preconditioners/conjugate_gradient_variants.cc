@@ -0,0 +1,334 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// deal.II
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/lac/solver_cg.h>
+#include <deal.II/lac/solver_control.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/solvers/iterative_solvers_dealii_wrapper.h>
+
+/*
+ * Compares SolverFusedCG and SolverPipelinedCG to dealii::SolverCG (number of iterations and
+ * solution) for symmetric positive definite tridiagonal matrices: a well-conditioned matrix with
+ * and without (Jacobi) preconditioner, and an ill-conditioned matrix of a one-dimensional
+ * diffusion problem with variable coefficient and symmetric Gauss-Seidel preconditioner. Without
+ * residual replacement, the recurrences of SolverPipelinedCG drift so far in the latter case that
+ * the solver does not converge.
+ */
+namespace ExaDG
+{
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+/*
+ * Symmetric tridiagonal matrix with the given diagonal and the negative of the given
+ * off-diagonal entries.
+ */
+class TridiagonalMatrix
+{
+public:
+  TridiagonalMatrix(std::vector<double> const & diagonal_in,
+                    std::vector<double> const & off_diagonal_in)
+    : diagonal(diagonal_in), off_diagonal(off_diagonal_in)
+  {
+  }
+
+  unsigned int
+  size() const
+  {
+    return diagonal.size();
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    for(unsigned int i = 0; i < size(); ++i)
+    {
+      dst.local_element(i) = diagonal[i] * src.local_element(i);
+      if(i > 0)
+        dst.local_element(i) -= off_diagonal[i - 1] * src.local_element(i - 1);
+      if(i < size() - 1)
+        dst.local_element(i) -= off_diagonal[i] * src.local_element(i + 1);
+    }
+  }
+
+  // interface of OperatorBase::vmult() used by SolverFusedCG
+  void
+  vmult(VectorType &                                                        dst,
+        VectorType const &                                                  src,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_before_loop,
+        std::function<void(unsigned int const, unsigned int const)> const & operation_after_loop)
+    const
+  {
+    operation_before_loop(0, size());
+    vmult(dst, src);
+    operation_after_loop(0, size());
+  }
+
+  std::vector<double> const diagonal;
+  std::vector<double> const off_diagonal;
+};
+
+class PreconditionerJacobi
+{
+public:
+  PreconditionerJacobi(TridiagonalMatrix const & matrix_in) : matrix(matrix_in)
+  {
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    for(unsigned int i = 0; i < matrix.size(); ++i)
+      dst.local_element(i) = src.local_element(i) / matrix.diagonal[i];
+  }
+
+  void
+  update()
+  {
+  }
+
+  std::shared_ptr<TimerTree>
+  get_timings() const
+  {
+    return std::make_shared<TimerTree>();
+  }
+
+private:
+  TridiagonalMatrix const & matrix;
+};
+
+/*
+ * Symmetric Gauss-Seidel preconditioner M = (D - L) D^{-1} (D - L^T), where D is the diagonal and
+ * -L the strictly lower part of the matrix.
+ */
+class PreconditionerSymmetricGaussSeidel
+{
+public:
+  PreconditionerSymmetricGaussSeidel(TridiagonalMatrix const & matrix_in) : matrix(matrix_in)
+  {
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    unsigned int const n = matrix.size();
+
+    // forward substitution (D - L) y = src, multiplication by D
+    std::vector<double> y(n);
+    for(unsigned int i = 0; i < n; ++i)
+    {
+      y[i] = src.local_element(i);
+      if(i > 0)
+        y[i] += matrix.off_diagonal[i - 1] * y[i - 1];
+      y[i] /= matrix.diagonal[i];
+    }
+
+    for(unsigned int i = 0; i < n; ++i)
+      y[i] *= matrix.diagonal[i];
+
+    // backward substitution (D - L^T) dst = D y
+    for(unsigned int i = n; i-- > 0;)
+    {
+      double value = y[i];
+      if(i < n - 1)
+        value += matrix.off_diagonal[i] * dst.local_element(i + 1);
+      dst.local_element(i) = value / matrix.diagonal[i];
+    }
+  }
+
+  void
+  update()
+  {
+  }
+
+  std::shared_ptr<TimerTree>
+  get_timings() const
+  {
+    return std::make_shared<TimerTree>();
+  }
+
+private:
+  TridiagonalMatrix const & matrix;
+};
+
+template<typename Solver, typename Preconditioner>
+void
+compare_to_reference(std::string const &       name,
+                     TridiagonalMatrix const & matrix,
+                     Preconditioner &          preconditioner,
+                     bool const                use_preconditioner,
+                     double const              rel_tol,
+                     VectorType const &        rhs,
+                     VectorType const &        solution_reference)
+{
+  Krylov::SolverDataCG solver_data;
+  solver_data.max_iter             = 10000;
+  solver_data.solver_tolerance_abs = 1.e-20;
+  solver_data.solver_tolerance_rel = rel_tol;
+  solver_data.use_preconditioner   = use_preconditioner;
+
+  Solver solver(matrix, preconditioner, solver_data);
+
+  VectorType solution(rhs.size());
+
+  unsigned int const n_iterations = solver.solve(solution, rhs);
+
+  solution -= solution_reference;
+  bool const same_solution = solution.linfty_norm() < 1.e-8 * solution_reference.linfty_norm();
+
+  std::cout << "  " << name << n_iterations
+            << " iterations, same solution: " << (same_solution ? "yes" : "no") << std::endl;
+}
+
+template<typename Preconditioner>
+void
+test(TridiagonalMatrix const & matrix,
+     Preconditioner &          preconditioner,
+     bool const                use_preconditioner,
+     double const              rel_tol)
+{
+  unsigned int const n = matrix.size();
+
+  VectorType rhs(n), solution_reference(n);
+  for(unsigned int i = 0; i < n; ++i)
+    rhs.local_element(i) = 1.0 + 0.01 * i;
+
+  // reference
+  dealii::ReductionControl     solver_control(10000, 1.e-20, rel_tol);
+  dealii::SolverCG<VectorType> solver_reference(solver_control);
+  if(use_preconditioner)
+    solver_reference.solve(matrix, solution_reference, rhs, preconditioner);
+  else
+    solver_reference.solve(matrix, solution_reference, rhs, dealii::PreconditionIdentity());
+
+  std::cout << "  dealii::SolverCG:  " << solver_control.last_step() << " iterations"
+            << std::endl;
+
+  compare_to_reference<Krylov::SolverFusedCG<TridiagonalMatrix, Preconditioner, VectorType>>(
+    "SolverFusedCG:     ",
+    matrix,
+    preconditioner,
+    use_preconditioner,
+    rel_tol,
+    rhs,
+    solution_reference);
+
+  compare_to_reference<Krylov::SolverPipelinedCG<TridiagonalMatrix, Preconditioner, VectorType>>(
+    "SolverPipelinedCG: ",
+    matrix,
+    preconditioner,
+    use_preconditioner,
+    rel_tol,
+    rhs,
+    solution_reference);
+}
+
+void
+test_well_conditioned()
+{
+  unsigned int const n = 200;
+
+  std::vector<double> diagonal(n), off_diagonal(n - 1, 1.0);
+  for(unsigned int i = 0; i < n; ++i)
+    diagonal[i] = 2.0 + (i % 5);
+
+  TridiagonalMatrix    matrix(diagonal, off_diagonal);
+  PreconditionerJacobi jacobi(matrix);
+
+  std::cout << std::endl << "Without preconditioner:" << std::endl;
+  test(matrix, jacobi, false, 1.e-10);
+
+  std::cout << std::endl << "With Jacobi preconditioner:" << std::endl;
+  test(matrix, jacobi, true, 1.e-10);
+}
+
+void
+test_ill_conditioned()
+{
+  unsigned int const n = 500;
+
+  // diffusion coefficient varying by one order of magnitude
+  double const        pi = std::acos(-1.0);
+  std::vector<double> coefficient(n + 1);
+  for(unsigned int i = 0; i <= n; ++i)
+    coefficient[i] = std::pow(10.0, std::pow(std::sin(pi * i / (n + 1)), 2));
+
+  std::vector<double> diagonal(n), off_diagonal(n - 1);
+  for(unsigned int i = 0; i < n; ++i)
+    diagonal[i] = coefficient[i] + coefficient[i + 1];
+  for(unsigned int i = 0; i < n - 1; ++i)
+    off_diagonal[i] = coefficient[i + 1];
+
+  TridiagonalMatrix                  matrix(diagonal, off_diagonal);
+  PreconditionerSymmetricGaussSeidel gauss_seidel(matrix);
+
+  std::cout << std::endl
+            << "Ill-conditioned matrix with symmetric Gauss-Seidel preconditioner:" << std::endl;
+  test(matrix, gauss_seidel, true, 1.e-10);
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    ExaDG::test_well_conditioned();
+    ExaDG::test_ill_conditioned();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
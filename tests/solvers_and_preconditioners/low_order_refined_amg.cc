@@ -0,0 +1,172 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <iostream>
+
+// deal.II
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/dofs/dof_tools.h>
+#include <deal.II/fe/fe_q.h>
+#include <deal.II/fe/fe_system.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+
+// ExaDG
+#include <exadg/poisson/spatial_discretization/laplace_operator.h>
+#include <exadg/solvers_and_preconditioners/multigrid/coarse_grid_solvers.h>
+#include <exadg/solvers_and_preconditioners/preconditioners/low_order_refined_preconditioner.h>
+
+/*
+ * Solves a scalar Poisson problem discretized with continuous Q3 elements via MGCoarseKrylov with
+ * the low-order refined AMG preconditioner. As for the multigrid levels, the finite element is an
+ * FESystem of FE_Q with one component. The residual of the computed solution is checked.
+ */
+namespace ExaDG
+{
+unsigned int const dim    = 2;
+unsigned int const degree = 3;
+
+typedef double Number;
+
+typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+typedef Poisson::LaplaceOperator<dim, Number, 1> Operator;
+
+void
+test(unsigned int const n_refinements)
+{
+  std::cout << std::endl << "Refinements: " << n_refinements << std::endl;
+
+  dealii::Triangulation<dim> triangulation;
+  dealii::GridGenerator::hyper_cube(triangulation, 0.0, 1.0);
+  triangulation.refine_global(n_refinements);
+
+  dealii::MappingQ<dim> mapping(1);
+
+  dealii::FESystem<dim>   fe(dealii::FE_Q<dim>(degree), 1);
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+
+  dealii::AffineConstraints<Number> constraints;
+  dealii::DoFTools::make_zero_boundary_constraints(dof_handler, 0, constraints);
+  constraints.close();
+
+  typename dealii::MatrixFree<dim, Number>::AdditionalData additional_data;
+  additional_data.mapping_update_flags =
+    dealii::update_gradients | dealii::update_JxW_values | dealii::update_quadrature_points;
+  additional_data.mapping_update_flags_boundary_faces =
+    dealii::update_gradients | dealii::update_JxW_values | dealii::update_quadrature_points;
+
+  dealii::MatrixFree<dim, Number> matrix_free;
+  matrix_free.reinit(
+    mapping, dof_handler, constraints, dealii::QGauss<1>(degree + 1), additional_data);
+
+  std::shared_ptr<Poisson::BoundaryDescriptor<0, dim>> boundary_descriptor =
+    std::make_shared<Poisson::BoundaryDescriptor<0, dim>>();
+  boundary_descriptor->dirichlet_bc.insert(
+    std::make_pair(0, std::make_shared<dealii::Functions::ZeroFunction<dim>>(1)));
+
+  Poisson::LaplaceOperatorData<0, dim> operator_data;
+  operator_data.bc = boundary_descriptor;
+
+  Operator laplace_operator;
+  laplace_operator.initialize(matrix_free, constraints, operator_data);
+
+  MGCoarseKrylov<Operator>::AdditionalData solver_data;
+  solver_data.solver_type    = KrylovSolverType::CG;
+  solver_data.solver_data    = SolverData(1000, 1.e-14, 1.e-8);
+  solver_data.preconditioner = MultigridCoarseGridPreconditioner::AMGLowOrderRefined;
+
+  std::shared_ptr<PreconditionerBase<Number>> preconditioner =
+    std::make_shared<LowOrderRefinedAMGPreconditioner<dim, Number>>(
+      dof_handler,
+      mapping,
+      constraints,
+      dealii::numbers::invalid_unsigned_int,
+      solver_data.amg_data);
+
+  MGCoarseKrylov<Operator> coarse_solver(laplace_operator,
+                                         solver_data,
+                                         dof_handler.get_communicator(),
+                                         preconditioner);
+  coarse_solver.update();
+
+  VectorType rhs, solution, residual;
+  laplace_operator.initialize_dof_vector(rhs);
+  laplace_operator.initialize_dof_vector(solution);
+  laplace_operator.initialize_dof_vector(residual);
+
+  rhs = 1.0;
+  constraints.set_zero(rhs);
+
+  coarse_solver(0, solution, rhs);
+
+  laplace_operator.vmult(residual, solution);
+  residual.sadd(-1.0, 1.0, rhs);
+
+  bool const converged = residual.l2_norm() < 1.e-6 * rhs.l2_norm();
+
+  std::cout << "  MGCoarseKrylov with low-order refined AMG converged: "
+            << (converged ? "yes" : "no") << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    ExaDG::test(2);
+    ExaDG::test(3);
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
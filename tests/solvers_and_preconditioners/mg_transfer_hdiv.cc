@@ -0,0 +1,236 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <cmath>
+#include <iostream>
+
+// deal.II
+#include <deal.II/base/function.h>
+#include <deal.II/base/mg_level_object.h>
+#include <deal.II/dofs/dof_handler.h>
+#include <deal.II/fe/fe_raviart_thomas.h>
+#include <deal.II/fe/mapping_q.h>
+#include <deal.II/grid/grid_generator.h>
+#include <deal.II/grid/tria.h>
+#include <deal.II/lac/affine_constraints.h>
+#include <deal.II/matrix_free/matrix_free.h>
+#include <deal.II/numerics/vector_tools.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/multigrid/transfers/mg_transfer_hdiv.h>
+
+/*
+ * Tests the h-transfer of MGTransferHDIV between two levels of a Raviart-Thomas discretization
+ * whose normal components are of degree 2, so that linear vector fields are contained in the
+ * finite element space. The prolongation of the interpolant of a linear vector field on the
+ * coarse level reproduces the interpolant on the fine level, the interpolation from the fine to
+ * the coarse level recovers the coarse interpolant, and the restriction is the transpose of the
+ * prolongation.
+ */
+namespace ExaDG
+{
+unsigned int const dim    = 2;
+unsigned int const degree = 2;
+
+typedef double Number;
+
+typedef dealii::LinearAlgebra::distributed::Vector<Number> VectorType;
+
+class LinearField : public dealii::Function<dim>
+{
+public:
+  LinearField() : dealii::Function<dim>(dim)
+  {
+  }
+
+  double
+  value(dealii::Point<dim> const & p, unsigned int const component) const final
+  {
+    if(component == 0)
+      return 1.0 + 2.0 * p[0] - 0.5 * p[1];
+    else
+      return -0.3 + 0.7 * p[0] + 1.5 * p[1];
+  }
+};
+
+/*
+ * Interpolates the linear field on the active cells of a triangulation with the given number of
+ * global refinements and copies the result into a level vector of dof_handler_level, where the
+ * cells on the given level coincide with the active cells.
+ */
+void
+interpolate_on_level(VectorType &                    dst,
+                     dealii::DoFHandler<dim> const & dof_handler_level,
+                     unsigned int const              level,
+                     dealii::Mapping<dim> const &    mapping)
+{
+  dealii::Triangulation<dim> triangulation;
+  dealii::GridGenerator::subdivided_hyper_cube(triangulation, 2, 0.0, 1.0);
+  triangulation.refine_global(level);
+
+  dealii::DoFHandler<dim> dof_handler(triangulation);
+  dof_handler.distribute_dofs(dof_handler_level.get_fe());
+
+  dealii::Vector<Number> interpolant(dof_handler.n_dofs());
+  dealii::VectorTools::interpolate(mapping, dof_handler, LinearField(), interpolant);
+
+  unsigned int const dofs_per_cell = dof_handler.get_fe().n_dofs_per_cell();
+
+  std::vector<dealii::types::global_dof_index> indices(dofs_per_cell);
+  std::vector<dealii::types::global_dof_index> indices_level(dofs_per_cell);
+
+  // the cells are created in the same order
+  auto cell_level = dof_handler_level.begin_mg(level);
+  for(auto const & cell : dof_handler.active_cell_iterators())
+  {
+    cell->get_dof_indices(indices);
+    cell_level->get_mg_dof_indices(indices_level);
+
+    for(unsigned int i = 0; i < dofs_per_cell; ++i)
+      dst(indices_level[i]) = interpolant(indices[i]);
+
+    ++cell_level;
+  }
+}
+
+void
+test()
+{
+  dealii::Triangulation<dim> triangulation(
+    dealii::Triangulation<dim>::limit_level_difference_at_vertices);
+  dealii::GridGenerator::subdivided_hyper_cube(triangulation, 2, 0.0, 1.0);
+  triangulation.refine_global(1);
+
+  dealii::MappingQ<dim> mapping(1);
+
+  dealii::FE_RaviartThomasNodal<dim> fe(degree - 1);
+  dealii::DoFHandler<dim>            dof_handler(triangulation);
+  dof_handler.distribute_dofs(fe);
+  dof_handler.distribute_mg_dofs();
+
+  unsigned int const n_levels = triangulation.n_global_levels();
+
+  dealii::MGLevelObject<dealii::AffineConstraints<Number>> constraints(0, n_levels - 1);
+
+  dealii::MGLevelObject<std::shared_ptr<dealii::MatrixFree<dim, Number>>> matrix_free;
+  matrix_free.resize(0, n_levels - 1);
+
+  for(unsigned int level = 0; level < n_levels; ++level)
+  {
+    constraints[level].close();
+
+    typename dealii::MatrixFree<dim, Number>::AdditionalData additional_data;
+    additional_data.mg_level             = level;
+    additional_data.mapping_update_flags =
+      dealii::update_values | dealii::update_gradients | dealii::update_JxW_values;
+
+    matrix_free[level] = std::make_shared<dealii::MatrixFree<dim, Number>>();
+    matrix_free[level]->reinit(mapping,
+                               dof_handler,
+                               constraints[level],
+                               dealii::QGauss<1>(degree + 1),
+                               additional_data);
+  }
+
+  MGTransferHDIV<dim, Number, VectorType> transfer;
+  transfer.reinit(matrix_free);
+
+  VectorType coarse, fine, fine_reference, coarse_interpolated;
+  matrix_free[0]->initialize_dof_vector(coarse);
+  matrix_free[0]->initialize_dof_vector(coarse_interpolated);
+  matrix_free[1]->initialize_dof_vector(fine);
+  matrix_free[1]->initialize_dof_vector(fine_reference);
+
+  interpolate_on_level(coarse, dof_handler, 0, mapping);
+  interpolate_on_level(fine_reference, dof_handler, 1, mapping);
+
+  // prolongation
+  transfer.prolongate_and_add(1, fine, coarse);
+  fine -= fine_reference;
+
+  std::cout << "Prolongation reproduces the fine interpolant: "
+            << (fine.linfty_norm() < 1.e-12 * fine_reference.linfty_norm() ? "yes" : "no")
+            << std::endl;
+
+  // interpolation
+  transfer.interpolate(1, coarse_interpolated, fine_reference);
+  coarse_interpolated -= coarse;
+
+  std::cout << "Interpolation reproduces the coarse interpolant: "
+            << (coarse_interpolated.linfty_norm() < 1.e-12 * coarse.linfty_norm() ? "yes" : "no")
+            << std::endl;
+
+  // restriction is the transpose of the prolongation, (R f, c) = (f, P c)
+  VectorType restricted, prolongated;
+  matrix_free[0]->initialize_dof_vector(restricted);
+  matrix_free[1]->initialize_dof_vector(prolongated);
+
+  transfer.restrict_and_add(1, restricted, fine_reference);
+  transfer.prolongate_and_add(1, prolongated, coarse);
+
+  double const product_coarse = restricted * coarse;
+  double const product_fine   = fine_reference * prolongated;
+
+  bool const is_transpose =
+    std::abs(product_coarse - product_fine) < 1.e-12 * std::abs(product_fine);
+
+  std::cout << "Restriction is the transpose of the prolongation: "
+            << (is_transpose ? "yes" : "no") << std::endl;
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    ExaDG::test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}
@@ -0,0 +1,286 @@
+/*  ______________________________________________________________________
+ *
+ *  ExaDG - High-Order Discontinuous Galerkin for the Exa-Scale
+ *
+ *  Copyright (C) 2021 by the ExaDG authors
+ *
+ *  This program is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 3 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ *  ______________________________________________________________________
+ */
+
+// C++
+#include <iostream>
+#include <memory>
+#include <string>
+
+// deal.II
+#include <deal.II/base/mg_level_object.h>
+#include <deal.II/lac/la_parallel_vector.h>
+#include <deal.II/multigrid/mg_base.h>
+
+// ExaDG
+#include <exadg/solvers_and_preconditioners/multigrid/multigrid_algorithm.h>
+#include <exadg/solvers_and_preconditioners/multigrid/multigrid_parameters.h>
+#include <exadg/solvers_and_preconditioners/multigrid/smoothers/smoother_base.h>
+#include <exadg/solvers_and_preconditioners/multigrid/transfers/mg_transfer.h>
+
+/*
+ * Solves a one-dimensional Poisson problem discretized with linear finite elements by a
+ * stationary iteration preconditioned by MultigridAlgorithm (damped Jacobi smoother, linear
+ * interpolation, exact coarse-grid solver) and checks that the W-, F-, and K-cycle reduce the
+ * residual at least as fast as the V-cycle, i.e., need at most as many iterations.
+ */
+namespace ExaDG
+{
+typedef dealii::LinearAlgebra::distributed::Vector<double> VectorType;
+
+unsigned int const max_level = 6;
+unsigned int const max_iter  = 100;
+
+/*
+ * Stiffness matrix tridiag(-1, 2, -1) / h with 2^(level + 1) - 1 interior nodes, which is the
+ * Galerkin coarse-grid operator of the next finer level.
+ */
+class LevelMatrix
+{
+public:
+  LevelMatrix(unsigned int const level)
+    : n_dofs((1u << (level + 1)) - 1), h_inverse(double(n_dofs + 1))
+  {
+  }
+
+  void
+  initialize_dof_vector(VectorType & vector) const
+  {
+    vector.reinit(n_dofs);
+  }
+
+  double
+  diagonal() const
+  {
+    return 2.0 * h_inverse;
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const
+  {
+    for(unsigned int i = 0; i < n_dofs; ++i)
+    {
+      dst.local_element(i) = 2.0 * src.local_element(i);
+      if(i > 0)
+        dst.local_element(i) -= src.local_element(i - 1);
+      if(i < n_dofs - 1)
+        dst.local_element(i) -= src.local_element(i + 1);
+      dst.local_element(i) *= h_inverse;
+    }
+  }
+
+  void
+  vmult_interface_down(VectorType & dst, VectorType const & src) const
+  {
+    vmult(dst, src);
+  }
+
+  unsigned int const n_dofs;
+
+private:
+  double const h_inverse;
+};
+
+/*
+ * Linear interpolation between the nodes of two successive levels and its transpose.
+ */
+class Transfer : public MGTransfer<VectorType>
+{
+public:
+  void
+  interpolate(unsigned int const, VectorType & dst, VectorType const & src) const final
+  {
+    for(unsigned int j = 0; j < dst.locally_owned_size(); ++j)
+      dst.local_element(j) = src.local_element(2 * j + 1);
+  }
+
+  void
+  restrict_and_add(unsigned int const, VectorType & dst, VectorType const & src) const final
+  {
+    for(unsigned int j = 0; j < dst.locally_owned_size(); ++j)
+      dst.local_element(j) += src.local_element(2 * j + 1) +
+                              0.5 * (src.local_element(2 * j) + src.local_element(2 * j + 2));
+  }
+
+  void
+  prolongate_and_add(unsigned int const, VectorType & dst, VectorType const & src) const final
+  {
+    for(unsigned int j = 0; j < src.locally_owned_size(); ++j)
+    {
+      dst.local_element(2 * j + 1) += src.local_element(j);
+      dst.local_element(2 * j) += 0.5 * src.local_element(j);
+      dst.local_element(2 * j + 2) += 0.5 * src.local_element(j);
+    }
+  }
+};
+
+class JacobiSmoother : public SmootherBase<VectorType>
+{
+public:
+  JacobiSmoother(LevelMatrix const & matrix_in) : matrix(matrix_in)
+  {
+    matrix.initialize_dof_vector(residual);
+  }
+
+  void
+  vmult(VectorType & dst, VectorType const & src) const final
+  {
+    dst.equ(omega / matrix.diagonal(), src);
+  }
+
+  void
+  step(VectorType & dst, VectorType const & src) const final
+  {
+    matrix.vmult(residual, dst);
+    residual.sadd(-1.0, 1.0, src);
+    dst.add(omega / matrix.diagonal(), residual);
+  }
+
+private:
+  double const omega = 2.0 / 3.0;
+
+  LevelMatrix const & matrix;
+
+  mutable VectorType residual;
+};
+
+/*
+ * The coarsest level has a single unknown.
+ */
+class CoarseGridSolver : public dealii::MGCoarseGridBase<VectorType>
+{
+public:
+  CoarseGridSolver(LevelMatrix const & matrix_in) : matrix(matrix_in)
+  {
+  }
+
+  void
+  operator()(unsigned int const, VectorType & dst, VectorType const & src) const final
+  {
+    dst.equ(1.0 / matrix.diagonal(), src);
+  }
+
+private:
+  LevelMatrix const & matrix;
+};
+
+unsigned int
+solve(MultigridCycle const cycle_type)
+{
+  dealii::MGLevelObject<std::shared_ptr<LevelMatrix>>    matrices(0, max_level);
+  dealii::MGLevelObject<std::shared_ptr<JacobiSmoother>> smoothers(0, max_level);
+  for(unsigned int level = 0; level <= max_level; ++level)
+  {
+    matrices[level]  = std::make_shared<LevelMatrix>(level);
+    smoothers[level] = std::make_shared<JacobiSmoother>(*matrices[level]);
+  }
+
+  CoarseGridSolver coarse_grid_solver(*matrices[0]);
+  Transfer         transfer;
+
+  MultigridAlgorithm<VectorType, LevelMatrix, JacobiSmoother> multigrid(
+    matrices, coarse_grid_solver, transfer, smoothers, MPI_COMM_SELF, cycle_type);
+
+  LevelMatrix const & matrix = *matrices[max_level];
+
+  VectorType rhs, solution, residual, correction;
+  matrix.initialize_dof_vector(rhs);
+  matrix.initialize_dof_vector(solution);
+  matrix.initialize_dof_vector(residual);
+  matrix.initialize_dof_vector(correction);
+
+  rhs = 1.0 / double(matrix.n_dofs + 1);
+
+  double const norm_rhs = rhs.l2_norm();
+
+  unsigned int n_iter = 0;
+  residual            = rhs;
+  while(residual.l2_norm() > 1.e-10 * norm_rhs and n_iter < max_iter)
+  {
+    multigrid.vmult(correction, residual);
+    solution += correction;
+
+    matrix.vmult(residual, solution);
+    residual.sadd(-1.0, 1.0, rhs);
+
+    ++n_iter;
+  }
+
+  return n_iter;
+}
+
+void
+compare_to_V_cycle(std::string const &  name,
+                   MultigridCycle const cycle_type,
+                   unsigned int const   n_iter_V)
+{
+  std::cout << name << "-cycle converges at least as fast as the V-cycle: "
+            << (solve(cycle_type) <= n_iter_V ? "yes" : "no") << std::endl;
+}
+
+void
+test()
+{
+  unsigned int const n_iter_V = solve(MultigridCycle::V);
+
+  std::cout << "V-cycle converged: " << (n_iter_V < max_iter ? "yes" : "no") << std::endl;
+
+  compare_to_V_cycle("W", MultigridCycle::W, n_iter_V);
+  compare_to_V_cycle("F", MultigridCycle::F, n_iter_V);
+  compare_to_V_cycle("K", MultigridCycle::K, n_iter_V);
+}
+
+} // namespace ExaDG
+
+int
+main(int argc, char ** argv)
+{
+  try
+  {
+    dealii::Utilities::MPI::MPI_InitFinalize mpi(argc, argv, 1);
+
+    dealii::deallog.depth_console(0);
+
+    ExaDG::test();
+  }
+  catch(std::exception & exc)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Exception on processing: " << std::endl
+              << exc.what() << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+  catch(...)
+  {
+    std::cerr << std::endl
+              << std::endl
+              << "----------------------------------------------------" << std::endl;
+    std::cerr << "Unknown exception!" << std::endl
+              << "Aborting!" << std::endl
+              << "----------------------------------------------------" << std::endl;
+    return 1;
+  }
+
+  return 0;
+}